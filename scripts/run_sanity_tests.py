@@ -23,7 +23,7 @@ subprocess.run(['./PDEapprox', '-w'], check=True)
 # Now, run sanity tests for all permutations of files
 domains = ['real', 'interval', 'affine', 'mixed']
 fluxes = ['cubic', 'burgers', 'lwr', 'buckley_leverett']
-solvers = ['lax_friedrichs', 'leapfrog']
+solvers = ['lax_friedrichs', 'leapfrog', 'local_lax_friedrichs']
 
 for domain in domains:
     for flux in fluxes:
@@ -41,4 +41,19 @@ for domain in domains:
             time_after = time.perf_counter()
             print()
             print(f'Test completed in {time_after - time_before:.4f} seconds.\n')
-            stdout.flush() # ensure output is printed in order if redirected to file
\ No newline at end of file
+            stdout.flush() # ensure output is printed in order if redirected to file
+
+# Finite volume runs over a nonuniform grid, refined around the Burgers shock.
+for domain in domains:
+    print(f'Running test: Domain={domain}, Flux=burgers, Solver=local_lax_friedrichs (refined grid)')
+    print()
+    stdout.flush()
+    config = f'simulations/{domain}_burgers_local_lax_friedrichs_refined_config.json'
+    conds = f'simulations/burgers_{domain}_conds.json'
+
+    time_before = time.perf_counter()
+    subprocess.run(['./PDEapprox', '-c', config, '-s', conds, '-t'], check=True)
+    time_after = time.perf_counter()
+    print()
+    print(f'Test completed in {time_after - time_before:.4f} seconds.\n')
+    stdout.flush()
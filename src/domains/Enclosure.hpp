@@ -0,0 +1,101 @@
+//
+// Created by will on 12/5/25.
+//
+
+#ifndef PDENCLOSE_ENCLOSURE_H
+#define PDENCLOSE_ENCLOSURE_H
+
+#include <algorithm>
+#include <cstdint>
+
+#include "domains/Numeric.hpp"
+#include "domains/Real.hpp"
+#include "domains/RealBatch.hpp"
+
+#include "Caffeine/AffineForm.hpp"
+#include "DualDomain/MixedForm.hpp"
+#include "Winterval/Winterval.hpp"
+
+/**
+ * Conversion between values of a numeric domain and the range of reals they enclose.
+ * Specialized for each supported domain.
+ *
+ * @tparam T Numeric type to convert.
+ */
+template<typename T>
+requires Numeric<T>
+struct Enclosure {
+    /**
+     * @return A value enclosing every real in [min, max].
+     */
+    static T from_bounds(double min, double max);
+
+    /**
+     * @return The smallest interval containing every real value enclosed by value.
+     */
+    static Winterval bounds(const T &value);
+};
+
+/**
+ * Reals cannot represent uncertainty, so ranges collapse to their midpoint.
+ */
+template<>
+struct Enclosure<Real> {
+    static Real from_bounds(double min, double max) {
+        return Real((min + max) / 2);
+    }
+    static Winterval bounds(const Real &value) {
+        return Winterval(value.value(), value.value());
+    }
+};
+
+template<>
+struct Enclosure<Winterval> {
+    static Winterval from_bounds(double min, double max) {
+        return Winterval(min, max);
+    }
+    static Winterval bounds(const Winterval &value) {
+        return value;
+    }
+};
+
+template<>
+struct Enclosure<AffineForm> {
+    static AffineForm from_bounds(double min, double max) {
+        return AffineForm(Winterval(min, max));
+    }
+    static Winterval bounds(const AffineForm &value) {
+        return value.to_interval();
+    }
+};
+
+template<>
+struct Enclosure<MixedForm> {
+    static MixedForm from_bounds(double min, double max) {
+        return MixedForm(Winterval(min, max));
+    }
+    static Winterval bounds(const MixedForm &value) {
+        return value.interval_bounds();
+    }
+};
+
+/**
+ * Batches hold independent reals, so ranges are broadcast as their midpoint, and a batch encloses the hull of its lanes.
+ */
+template<uint32_t Lanes>
+struct Enclosure<RealBatch<Lanes>> {
+    static RealBatch<Lanes> from_bounds(double min, double max) {
+        return RealBatch<Lanes>((min + max) / 2);
+    }
+    static Winterval bounds(const RealBatch<Lanes> &value) {
+        auto min = value.value(0);
+        auto max = value.value(0);
+        for (uint32_t lane = 1; lane < Lanes; lane++) {
+            min = std::min(min, value.value(lane));
+            max = std::max(max, value.value(lane));
+        }
+        return Winterval(min, max);
+    }
+};
+
+#endif //PDENCLOSE_ENCLOSURE_H
@@ -0,0 +1,138 @@
+//
+// Created by will on 12/10/25.
+//
+
+#ifndef PDENCLOSE_LINEARCOMBINATION_H
+#define PDENCLOSE_LINEARCOMBINATION_H
+#include <array>
+#include <concepts>
+#include <cstddef>
+
+#include "domains/Numeric.hpp"
+
+/**
+ * Domains which evaluate a whole linear combination in one pass, through a static
+ * linear_combination(terms, coefficients, count, constant).
+ */
+template<typename T>
+concept FusedLinearCombination = requires(const T *terms, const double *coefficients, size_t count, double constant) {
+    { T::linear_combination(terms, coefficients, count, constant) } -> std::same_as<T>;
+};
+
+/**
+ * Sum of scaled values plus a constant, c_0 * x_0 + ... + c_{N-1} * x_{N-1} + k, built up by operators and evaluated at once.
+ * i.e. T complement = scaled(value, -1) + 1;
+ *
+ * Only domains with a fused evaluation build combinations; for every other domain, scaled() returns coefficient * term,
+ * so sums are evaluated exactly as written. Affine and mixed forms would gain most from merging their noise symbols
+ * in one pass, but their noise maps are private to their libraries.
+ *
+ * Terms are summed in order and the constant is added last.
+ * This matches writing out the sum only for a single constant and no parenthesised combinations.
+ * Constants added along the way are summed in double precision first, so scaled(x, a) + 1 + 2 evaluates x * a + 3,
+ * and combinations joined by + or - are flattened, so their results may differ from the written-out sum at rounding level.
+ *
+ * Terms are copied into the combination, so it may outlive the values it was built from.
+ *
+ * @tparam T Numeric type of each term.
+ * @tparam N Number of terms.
+ */
+template<typename T, size_t N>
+requires Numeric<T> && FusedLinearCombination<T>
+class LinearCombination {
+public:
+    LinearCombination(const std::array<T, N> &terms, const std::array<double, N> &coefficients, double constant):
+        _terms(terms), _coefficients(coefficients), _constant(constant) {}
+
+    /*
+     * Operations
+     */
+    LinearCombination operator+(double constant) const {
+        return {_terms, _coefficients, _constant + constant};
+    }
+    LinearCombination operator-(double constant) const {
+        return {_terms, _coefficients, _constant - constant};
+    }
+    LinearCombination<T, N + 1> operator+(const T &term) const {
+        return append(term, 1);
+    }
+    LinearCombination<T, N + 1> operator-(const T &term) const {
+        return append(term, -1);
+    }
+    template<size_t M>
+    LinearCombination<T, N + M> operator+(const LinearCombination<T, M> &right) const {
+        return concatenate(right, 1);
+    }
+    template<size_t M>
+    LinearCombination<T, N + M> operator-(const LinearCombination<T, M> &right) const {
+        return concatenate(right, -1);
+    }
+
+    /**
+     * @return The value of the combination.
+     */
+    T evaluate() const {
+        return T::linear_combination(_terms.data(), _coefficients.data(), N, _constant);
+    }
+    operator T() const {
+        return evaluate();
+    }
+
+    const std::array<T, N> &terms() const {
+        return _terms;
+    }
+    const std::array<double, N> &coefficients() const {
+        return _coefficients;
+    }
+    double constant() const {
+        return _constant;
+    }
+
+private:
+    std::array<T, N> _terms;
+    std::array<double, N> _coefficients;
+    double _constant;
+
+    LinearCombination<T, N + 1> append(const T &term, double coefficient) const {
+        auto terms = std::array<T, N + 1>();
+        auto coefficients = std::array<double, N + 1>();
+        for (size_t i = 0; i < N; i++) {
+            terms[i] = _terms[i];
+            coefficients[i] = _coefficients[i];
+        }
+        terms[N] = term;
+        coefficients[N] = coefficient;
+        return {terms, coefficients, _constant};
+    }
+
+    template<size_t M>
+    LinearCombination<T, N + M> concatenate(const LinearCombination<T, M> &right, double sign) const {
+        auto terms = std::array<T, N + M>();
+        auto coefficients = std::array<double, N + M>();
+        for (size_t i = 0; i < N; i++) {
+            terms[i] = _terms[i];
+            coefficients[i] = _coefficients[i];
+        }
+        for (size_t i = 0; i < M; i++) {
+            terms[N + i] = right.terms()[i];
+            coefficients[N + i] = right.coefficients()[i] * sign;
+        }
+        return {terms, coefficients, _constant + right.constant() * sign};
+    }
+};
+
+/**
+ * @return The combination coefficient * term, to extend with further terms and constants,
+ * or just coefficient * term for domains without a fused evaluation.
+ */
+template<typename T>
+requires Numeric<T>
+auto scaled(const T &term, double coefficient) {
+    if constexpr (FusedLinearCombination<T>) {
+        return LinearCombination<T, 1>({term}, {coefficient}, 0);
+    } else {
+        return term * coefficient;
+    }
+}
+
+#endif //PDENCLOSE_LINEARCOMBINATION_H
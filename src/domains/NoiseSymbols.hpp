@@ -0,0 +1,101 @@
+//
+// Created by will on 12/2/25.
+//
+
+#ifndef PDENCLOSE_NOISESYMBOLS_H
+#define PDENCLOSE_NOISESYMBOLS_H
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "domains/Numeric.hpp"
+
+#include "cereal/archives/json.hpp"
+#include "Caffeine/AffineForm.hpp"
+#include "DualDomain/MixedForm.hpp"
+#include "Winterval/Winterval.hpp"
+
+/**
+ * Access to the global noise symbol counter of a numeric domain.
+ * Domains without noise symbols (i.e. reals and intervals) have no state to save.
+ *
+ * This is needed to resume a simulation: forms restored from disk reference noise symbols
+ * allocated by a previous process, so fresh symbols must not be handed out a second time.
+ *
+ * @tparam T Numeric type whose noise symbols are tracked.
+ */
+template<typename T>
+requires Numeric<T>
+struct NoiseSymbols {
+    /**
+     * Whether the domain allocates noise symbols from a counter local to each process.
+     */
+    static constexpr bool allocated = false;
+
+    /**
+     * @return A marker for the current position of the noise symbol counter.
+     */
+    static uint64_t counter() {
+        return 0;
+    }
+
+    /**
+     * Advance the noise symbol counter past a marker produced by counter().
+     * @param marker Marker to restore to.
+     */
+    static void restore(uint64_t) {}
+};
+
+/**
+ * Caffeine does not expose its counter directly, so we observe it by allocating a probe form
+ * and reading back the id of the single noise symbol it was given.
+ * Note that each probe consumes one noise symbol.
+ */
+template<>
+struct NoiseSymbols<AffineForm> {
+    static constexpr bool allocated = true;
+
+    static uint64_t counter() {
+        std::ostringstream ss;
+        // Inner scope needed to ensure proper flushing.
+        {
+            cereal::JSONOutputArchive archive(ss);
+            archive(AffineForm(Winterval(0, 1)));
+        }
+        auto json = ss.str();
+        auto key_position = json.find("\"key\"");
+        auto value_position = key_position == std::string::npos ? std::string::npos : json.find(':', key_position);
+        if (value_position == std::string::npos) {
+            std::cerr << "Could not find the noise symbol counter of an affine form!" << std::endl;
+            exit(EXIT_FAILURE);
+        }
+        char *end = nullptr;
+        auto counter = std::strtoull(json.c_str() + value_position + 1, &end, 10);
+        if (end == json.c_str() + value_position + 1) {
+            std::cerr << "Could not read the noise symbol counter of an affine form!" << std::endl;
+            exit(EXIT_FAILURE);
+        }
+        return counter;
+    }
+
+    static void restore(uint64_t marker) {
+        // Noise symbols are handed out sequentially, so burn through the gap, then check where we landed.
+        auto current = counter();
+        while (current < marker) {
+            for (auto symbol = current + 1; symbol < marker; symbol++) {
+                auto burned = AffineForm(Winterval(0, 1));
+            }
+            current = counter();
+        }
+    }
+};
+
+/**
+ * Mixed forms draw their noise symbols from the same counter as affine forms.
+ */
+template<>
+struct NoiseSymbols<MixedForm> : NoiseSymbols<AffineForm> {};
+
+#endif //PDENCLOSE_NOISESYMBOLS_H
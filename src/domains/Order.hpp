@@ -0,0 +1,28 @@
+//
+// Created by will on 12/10/25.
+//
+
+#ifndef PDENCLOSE_ORDER_H
+#define PDENCLOSE_ORDER_H
+
+#include "domains/Numeric.hpp"
+
+/*
+ * Order operations written with abs rather than comparisons, so they apply to every domain.
+ * Over enclosures, the result encloses the minimum or maximum of every pair of enclosed values,
+ * and over batches, each lane is ordered independently.
+ */
+
+template<typename T>
+requires Numeric<T>
+T numeric_min(const T &a, const T &b) {
+    return (a + b - (a - b).abs()) * 0.5;
+}
+
+template<typename T>
+requires Numeric<T>
+T numeric_max(const T &a, const T &b) {
+    return (a + b + (a - b).abs()) * 0.5;
+}
+
+#endif //PDENCLOSE_ORDER_H
@@ -61,3 +61,18 @@ Real Real::pow(uint32_t power) const {
 Real Real::abs() const {
     return { std::abs(_value) };
 }
+
+Real Real::linear_combination(const Real *terms, const double *coefficients, size_t count, double constant) {
+    // Same operations, in the same order, as evaluating term by term.
+    auto result = coefficients[0] == 1 ? terms[0]._value : terms[0]._value * coefficients[0];
+    for (size_t i = 1; i < count; i++) {
+        if (coefficients[i] == 1) {
+            result += terms[i]._value;
+        } else if (coefficients[i] == -1) {
+            result -= terms[i]._value;
+        } else {
+            result += terms[i]._value * coefficients[i];
+        }
+    }
+    return { constant == 0 ? result : result + constant };
+}
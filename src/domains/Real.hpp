@@ -4,6 +4,7 @@
 
 #ifndef PDENCLOSE_REAL_H
 #define PDENCLOSE_REAL_H
+#include <cstddef>
 #include <cstdint>
 #include <iosfwd>
 
@@ -37,6 +38,12 @@ public:
     Real pow(uint32_t power) const;
     Real abs() const;
 
+    /**
+     * @brief Evaluate a linear combination in one call, rather than a call per operation.
+     * See LinearCombination.
+     */
+    static Real linear_combination(const Real *terms, const double *coefficients, size_t count, double constant);
+
     /*
      * Serialization support through cereal.
      */
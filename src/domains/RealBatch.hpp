@@ -0,0 +1,164 @@
+//
+// Created by will on 12/6/25.
+//
+
+#ifndef PDENCLOSE_REALBATCH_H
+#define PDENCLOSE_REALBATCH_H
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+#include "cereal/types/array.hpp"
+
+/**
+ * A fixed number of independent real values, operated on lane by lane.
+ *
+ * Solving over batches runs Lanes real simulations at once: every operation is a short loop over lanes,
+ * which compilers vectorize. This is used to sample many real solutions cheaply.
+ *
+ * Operations are defined inline, unlike Real, so the lane loops can be fused into the surrounding stencil.
+ *
+ * @tparam Lanes Number of values in the batch.
+ */
+template<uint32_t Lanes>
+class RealBatch {
+public:
+    static constexpr uint32_t lanes = Lanes;
+
+    RealBatch() = default;
+    /**
+     * @param value Value of every lane.
+     */
+    RealBatch(double value) {
+        _values.fill(value);
+    }
+
+    double value(uint32_t lane) const {
+        return _values[lane];
+    }
+    void set(uint32_t lane, double value) {
+        _values[lane] = value;
+    }
+
+    /*
+     * Operations
+     */
+    RealBatch operator+(const RealBatch &right) const {
+        return apply(right, [](double a, double b) { return a + b; });
+    }
+    RealBatch operator-(const RealBatch &right) const {
+        return apply(right, [](double a, double b) { return a - b; });
+    }
+    RealBatch operator*(const RealBatch &right) const {
+        return apply(right, [](double a, double b) { return a * b; });
+    }
+    RealBatch operator/(const RealBatch &right) const {
+        return apply(right, [](double a, double b) { return a / b; });
+    }
+    RealBatch operator+(double right) const {
+        return *this + RealBatch(right);
+    }
+    RealBatch operator-(double right) const {
+        return *this - RealBatch(right);
+    }
+    RealBatch operator*(double right) const {
+        return *this * RealBatch(right);
+    }
+    RealBatch operator/(double right) const {
+        return *this / RealBatch(right);
+    }
+
+    bool operator==(const RealBatch &right) const {
+        return _values == right._values;
+    }
+
+    /*
+     * Comparisons against a scalar hold only if they hold in every lane, i.e. a CFL check passes only if every lane passes.
+     */
+    bool operator<(double right) const {
+        return std::all_of(_values.begin(), _values.end(), [right](double v) { return v < right; });
+    }
+    bool operator<=(double right) const {
+        return std::all_of(_values.begin(), _values.end(), [right](double v) { return v <= right; });
+    }
+    bool operator>(double right) const {
+        return std::all_of(_values.begin(), _values.end(), [right](double v) { return v > right; });
+    }
+    bool operator>=(double right) const {
+        return std::all_of(_values.begin(), _values.end(), [right](double v) { return v >= right; });
+    }
+
+    RealBatch pow(uint32_t power) const {
+        auto result = RealBatch();
+        for (uint32_t lane = 0; lane < Lanes; lane++) {
+            result._values[lane] = std::pow(_values[lane], power);
+        }
+        return result;
+    }
+    RealBatch abs() const {
+        auto result = RealBatch();
+        for (uint32_t lane = 0; lane < Lanes; lane++) {
+            result._values[lane] = std::abs(_values[lane]);
+        }
+        return result;
+    }
+
+    /**
+     * @return The greater of each pair of lanes.
+     * Lanes are independent, so std::max cannot be used: batches have no total order.
+     */
+    static RealBatch max(const RealBatch &a, const RealBatch &b) {
+        return a.apply(b, [](double x, double y) { return std::max(x, y); });
+    }
+
+    /**
+     * @brief Evaluate a linear combination in one pass over the lanes, without intermediate batches.
+     * See LinearCombination.
+     */
+    static RealBatch linear_combination(const RealBatch *terms, const double *coefficients, size_t count, double constant) {
+        auto result = RealBatch(constant);
+        for (uint32_t lane = 0; lane < Lanes; lane++) {
+            auto sum = terms[0]._values[lane] * coefficients[0];
+            for (size_t i = 1; i < count; i++) {
+                sum += terms[i]._values[lane] * coefficients[i];
+            }
+            result._values[lane] = constant == 0 ? sum : sum + constant;
+        }
+        return result;
+    }
+
+    /*
+     * Serialization support through cereal.
+     */
+    template<class Archive>
+    void serialize(Archive & archive) {
+        archive(_values);
+    }
+
+private:
+    std::array<double, Lanes> _values;
+
+    template<typename Op>
+    RealBatch apply(const RealBatch &right, Op op) const {
+        auto result = RealBatch();
+        for (uint32_t lane = 0; lane < Lanes; lane++) {
+            result._values[lane] = op(_values[lane], right._values[lane]);
+        }
+        return result;
+    }
+};
+
+template<uint32_t Lanes>
+std::ostream &operator<<(std::ostream &os, const RealBatch<Lanes> &rhs) {
+    os << "{";
+    for (uint32_t lane = 0; lane < Lanes; lane++) {
+        os << (lane > 0 ? ", " : "") << std::to_string(rhs.value(lane));
+    }
+    return os << "}";
+}
+
+#endif //PDENCLOSE_REALBATCH_H
@@ -4,59 +4,134 @@
 
 #ifndef PDENCLOSE_MATCH_NAMES_H
 #define PDENCLOSE_MATCH_NAMES_H
-#include <cstdlib>
+#include <cstdint>
 #include <string>
 
+#include "Caffeine/AffineForm.hpp"
+#include "DualDomain/MixedForm.hpp"
+#include "Winterval/Winterval.hpp"
+#include "domains/Real.hpp"
+#include "exe/experiment/SimulationConfig.hpp"
 #include "flux/BuckleyLeverettFlux.hpp"
 #include "flux/BurgersFlux.hpp"
 #include "flux/CubicFlux.hpp"
-#include "flux/FluxFunction.hpp"
+#include "flux/ExpressionFlux.hpp"
 #include "flux/LwrFlux.hpp"
+#include "solvers/difference/LaxFriedrichsSolver.hpp"
 #include "solvers/difference/LeapfrogSolver.hpp"
+#include "solvers/volume/AdaptiveSolver.hpp"
+#include "solvers/volume/LocalLaxFriedrichsSolver.hpp"
+#include "solvers/volume/MusclSolver.hpp"
+#include "solvers/volume/RiemannSolver.hpp"
+#include "solvers/volume/WenoSolver.hpp"
 
-/**
+/*
+ * Registry of every domain, flux function, and solver available to simulations.
  *
- * @tparam T Numeric type to operate over.
- * @param name Name of the flux function
- * @return An initialized flux function corresponding to the name.
+ * Every combination is instantiated at compile time with its concrete flux type, so flux calls inside the solver
+ * are resolved statically. Names from the configuration are matched once, at startup.
+ * To register a new domain, flux, or scheme, add it to the corresponding list below.
  */
-template<typename T>
-requires Numeric<T>
-FluxFunction<T> *match_flux(const std::string &name) {
-    if (name == "buckley_leverett") {
-        return new BuckleyLeverett<T>();
-    }
-    if (name == "burgers") {
-        return new BurgersFlux<T>();
-    }
-    if (name == "cubic") {
-        return new CubicFlux<T>();
-    }
-    if (name == "lwr") {
-        return new LwrFlux<T>();
-    }
-    std::cerr << "Unsupported flux function!" << std::endl;
-    exit(EXIT_FAILURE);
-}
+
+template<typename... Ts>
+struct TypeList {};
 
 /**
- *
- * @tparam T Numeric type to operate over
- * @param name Name of finite difference scheme to match
- * @return An initialized finite difference solver for a given domain
+ * Configuration name of each numeric domain.
+ * Domains live in external libraries, so names are attached here rather than on the types.
  */
 template<typename T>
-requires Numeric<T>
-DifferenceSolver<T> *match_difference(const std::string &name) {
-    if (name == "lax_friedrichs") {
-        return new LaxFriedrichsSolver<T>();
-    }
-    if (name == "leapfrog") {
-        return new LeapfrogSolver<T>();
-    }
-    std::cerr << "Unsupported PDE solvers!" << std::endl;
-    exit(EXIT_FAILURE);
+struct DomainName;
+template<> struct DomainName<Real> { static constexpr auto value = "real"; };
+template<> struct DomainName<Winterval> { static constexpr auto value = "interval"; };
+template<> struct DomainName<AffineForm> { static constexpr auto value = "affine"; };
+template<> struct DomainName<MixedForm> { static constexpr auto value = "mixed"; };
+
+using Domains = TypeList<Real, Winterval, AffineForm, MixedForm>;
+
+template<typename T>
+using Fluxes = TypeList<BuckleyLeverett<T>, BurgersFlux<T>, CubicFlux<T>, ExpressionFlux<T>, LwrFlux<T>>;
+
+template<typename T, typename F>
+using Solvers = TypeList<LaxFriedrichsSolver<T, F>, LeapfrogSolver<T, F>, LocalLaxFriedrichsSolver<T, F>,
+    MusclSolver<T, F>, WenoSolver<T, F>, RiemannSolver<T, F>, AdaptiveSolver<T, F>>;
+
+/**
+ * The same flux or solver, over another numeric domain.
+ * i.e. RebindDomain<LaxFriedrichsSolver<Winterval, BurgersFlux<Winterval>>, Real> is LaxFriedrichsSolver<Real, BurgersFlux<Real>>.
+ */
+template<typename X, typename U>
+struct RebindDomain;
+template<template<typename> typename X, typename T, typename U>
+struct RebindDomain<X<T>, U> {
+    using type = X<U>;
+};
+template<template<typename, typename> typename X, typename T, typename F, typename U>
+struct RebindDomain<X<T, F>, U> {
+    using type = X<U, typename RebindDomain<F, U>::type>;
+};
+
+/**
+ * Options for a single simulation run, beyond its configuration.
+ */
+struct RunOptions {
+    // Path to initial conditions. Unused when resuming.
+    std::string initial_conds_path;
+    // Whether to run a CFL check pass on the solution mesh after execution.
+    bool run_cfl;
+    // Path to periodically checkpoint the simulation to. Empty if not checkpointing.
+    std::string checkpoint_path;
+    // Number of timesteps between checkpoints.
+    uint32_t checkpoint_interval;
+    // Whether to continue the simulation from the checkpoint instead of the initial conditions.
+    bool resume;
+    // Number of sub-boxes to split the initial uncertainty into. 0 solves the initial conditions directly.
+    uint32_t boxes;
+    // Number of real solutions to check against the enclosure. 0 skips verification.
+    uint64_t samples;
+    // Path to write the solution to. Empty prints it.
+    std::string output_path;
+};
+
+/**
+ * A fully specialized simulation for one domain, flux, and solver.
+ */
+using SimulationRunner = void (*)(const SimulationConfig &config, const RunOptions &options);
+
+/*
+ * Each level of the registry expands one type list into a fold over its members,
+ * returning the runner of the first member whose name matches.
+ */
+
+template<template<typename, typename, typename> typename Run, typename T, typename F, typename... Ss>
+SimulationRunner match_solver(const SimulationConfig &config, TypeList<Ss...>) {
+    SimulationRunner runner = nullptr;
+    ((config.solver == Ss::name && (runner = &Run<T, F, Ss>::run)) || ...);
+    return runner;
 }
 
+template<template<typename, typename, typename> typename Run, typename T, typename... Fs>
+SimulationRunner match_flux(const SimulationConfig &config, TypeList<Fs...>) {
+    SimulationRunner runner = nullptr;
+    ((config.flux == Fs::name && (runner = match_solver<Run, T, Fs>(config, Solvers<T, Fs>()))) || ...);
+    return runner;
+}
+
+template<template<typename, typename, typename> typename Run, typename... Ts>
+SimulationRunner match_domain(const SimulationConfig &config, TypeList<Ts...>) {
+    SimulationRunner runner = nullptr;
+    ((config.domain == DomainName<Ts>::value && (runner = match_flux<Run, Ts>(config, Fluxes<Ts>()))) || ...);
+    return runner;
+}
+
+/**
+ * @tparam Run Class template over domain, flux, and solver with a static run function matching SimulationRunner.
+ * @param config Configuration naming a domain, flux, and solver.
+ * @return The runner specialized for the configuration, or null if any name is unsupported.
+ */
+template<template<typename, typename, typename> typename Run>
+SimulationRunner match_simulation(const SimulationConfig &config) {
+    return match_domain<Run>(config, Domains());
+}
 
-#endif //PDENCLOSE_MATCH_NAMES_H
\ No newline at end of file
+#endif //PDENCLOSE_MATCH_NAMES_H
@@ -0,0 +1,47 @@
+//
+// Created by will on 12/4/25.
+//
+
+#ifndef PDENCLOSE_BOUNDARYCONDITIONS_H
+#define PDENCLOSE_BOUNDARYCONDITIONS_H
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+
+#include "SimulationConfig.hpp"
+#include "domains/Enclosure.hpp"
+#include "domains/Numeric.hpp"
+#include "meshes/BoundaryCondition.hpp"
+
+/**
+ * @brief Build the boundary condition described by a configuration.
+ * Exits if the boundary is unknown.
+ *
+ * @tparam T Numeric type of the simulation.
+ * @param config Configuration to build boundary condition for.
+ * @return The boundary condition to apply at both edges of the system.
+ */
+template<typename T>
+requires Numeric<T>
+std::shared_ptr<BoundaryCondition<T>> boundary_condition(const SimulationConfig &config) {
+    if (config.boundary == PeriodicBoundary<T>::name) {
+        return std::make_shared<PeriodicBoundary<T>>();
+    }
+    if (config.boundary == OutflowBoundary<T>::name) {
+        return std::make_shared<OutflowBoundary<T>>();
+    }
+    if (config.boundary == ReflectiveBoundary<T>::name) {
+        return std::make_shared<ReflectiveBoundary<T>>();
+    }
+    if (config.boundary == DirichletBoundary<T>::name) {
+        // Boundary values are exact, so enclose them as single points.
+        return std::make_shared<DirichletBoundary<T>>(
+            Enclosure<T>::from_bounds(config.boundary_left, config.boundary_left),
+            Enclosure<T>::from_bounds(config.boundary_right, config.boundary_right));
+    }
+
+    std::cerr << "Unsupported boundary condition!" << std::endl;
+    exit(EXIT_FAILURE);
+}
+
+#endif //PDENCLOSE_BOUNDARYCONDITIONS_H
@@ -0,0 +1,35 @@
+//
+// Created by will on 12/10/25.
+//
+
+#ifndef PDENCLOSE_FLUXFUNCTIONS_H
+#define PDENCLOSE_FLUXFUNCTIONS_H
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <type_traits>
+
+#include "SimulationConfig.hpp"
+
+/**
+ * @brief Build the flux function of a configuration.
+ * Fluxes built from an expression read it from the configuration, exiting if it is missing.
+ *
+ * @tparam F Flux function type.
+ * @param config Configuration to build flux function for.
+ * @return The flux function.
+ */
+template<typename F>
+F flux_function(const SimulationConfig &config) {
+    if constexpr (std::is_constructible_v<F, const std::string &>) {
+        if (config.flux_expression.empty()) {
+            std::cerr << "The " << F::name << " flux requires a flux_expression!" << std::endl;
+            exit(EXIT_FAILURE);
+        }
+        return F(config.flux_expression);
+    } else {
+        return F();
+    }
+}
+
+#endif //PDENCLOSE_FLUXFUNCTIONS_H
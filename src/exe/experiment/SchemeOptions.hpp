@@ -0,0 +1,106 @@
+//
+// Created by will on 12/10/25.
+//
+
+#ifndef PDENCLOSE_SCHEMEOPTIONS_H
+#define PDENCLOSE_SCHEMEOPTIONS_H
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+
+#include "SimulationConfig.hpp"
+#include "solvers/volume/AdaptiveSolver.hpp"
+#include "solvers/volume/LocalLaxFriedrichsSolver.hpp"
+#include "solvers/volume/LocalTimeSteppingSolver.hpp"
+#include "solvers/volume/MusclSolver.hpp"
+#include "solvers/volume/RiemannSolver.hpp"
+#include "solvers/volume/WenoSolver.hpp"
+
+/**
+ * @brief Apply the scheme specific options of a configuration to a solver.
+ * Solvers without options are left unchanged. Exits if an option is unknown.
+ *
+ * @tparam S Solver type.
+ * @param solver Solver to configure.
+ * @param config Configuration to read options from.
+ */
+template<typename S>
+void apply_scheme_options(S &solver, const SimulationConfig &config) {
+    if constexpr (requires { solver.set_limiter(SlopeLimiter::minmod); }) {
+        if (config.limiter == "minmod") {
+            solver.set_limiter(SlopeLimiter::minmod);
+        } else if (config.limiter == "van_leer") {
+            solver.set_limiter(SlopeLimiter::van_leer);
+        } else {
+            std::cerr << "Unsupported slope limiter!" << std::endl;
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    if constexpr (requires { solver.set_riemann_flux(RiemannFlux::godunov); }) {
+        if (config.riemann_flux == "godunov") {
+            solver.set_riemann_flux(RiemannFlux::godunov);
+        } else if (config.riemann_flux == "hll") {
+            solver.set_riemann_flux(RiemannFlux::hll);
+        } else {
+            std::cerr << "Unsupported Riemann flux!" << std::endl;
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    if constexpr (requires { solver.set_rk_order(config.rk_order); }) {
+        if (config.rk_order != 0 && config.rk_order != 2 && config.rk_order != 3) {
+            std::cerr << "Runge-Kutta order must be 2 or 3!" << std::endl;
+            exit(EXIT_FAILURE);
+        }
+        if (config.rk_order != 0) {
+            solver.set_rk_order(config.rk_order);
+        }
+    }
+
+    if constexpr (requires { solver.set_local_time_stepping(true); }) {
+        solver.set_local_time_stepping(config.local_time_stepping);
+    } else if (config.local_time_stepping) {
+        std::cerr << "Local time stepping is only supported by first order finite volume solvers!" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+}
+
+/**
+ * @brief Apply the options of a configuration to an adaptive solver, and to the scheme it refines over.
+ * Exits if an option is unknown.
+ */
+template<typename T, typename F>
+void apply_scheme_options(AdaptiveSolver<T, F> &solver, const SimulationConfig &config) {
+    auto configured = [&config](auto scheme) {
+        apply_scheme_options(*scheme, config);
+        return std::shared_ptr<VolumeSolver<T, F>>(std::move(scheme));
+    };
+    if (config.amr_scheme == LocalLaxFriedrichsSolver<T, F>::name) {
+        solver.set_scheme(configured(std::make_shared<LocalLaxFriedrichsSolver<T, F>>()));
+    } else if (config.amr_scheme == RiemannSolver<T, F>::name) {
+        solver.set_scheme(configured(std::make_shared<RiemannSolver<T, F>>()));
+    } else if (config.amr_scheme == MusclSolver<T, F>::name) {
+        solver.set_scheme(configured(std::make_shared<MusclSolver<T, F>>()));
+    } else if (config.amr_scheme == WenoSolver<T, F>::name) {
+        solver.set_scheme(configured(std::make_shared<WenoSolver<T, F>>()));
+    } else {
+        std::cerr << "Unsupported AMR scheme!" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+
+    auto criterion = RefinementCriterion::gradient;
+    if (config.amr_criterion == "width") {
+        criterion = RefinementCriterion::width;
+    } else if (config.amr_criterion != "gradient") {
+        std::cerr << "Unsupported refinement criterion!" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    if (config.amr_threshold <= 0 || config.amr_max_level >= TimeLevels::max_level || config.amr_regrid_interval == 0) {
+        std::cerr << "AMR needs a positive threshold and regrid interval, and a maximum level below " << TimeLevels::max_level << "!" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    solver.set_refinement(criterion, config.amr_threshold, config.amr_max_level, config.amr_regrid_interval);
+}
+
+#endif //PDENCLOSE_SCHEMEOPTIONS_H
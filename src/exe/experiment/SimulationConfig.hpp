@@ -4,6 +4,7 @@
 
 #ifndef PDENCLOSE_SIMULATIONCONFIG_H
 #define PDENCLOSE_SIMULATIONCONFIG_H
+#include <cstdint>
 #include <fstream>
 #include <string>
 #include <utility>
@@ -22,7 +23,7 @@ struct SimulationConfig {
 
     /**
      * @param domain Name of abstract domain serialized over. Options: real, interval, affine, mixed
-     * @param flux Name of flux function being serialized. Options: cubic, burgers, lwr, buckley_leverett
+     * @param flux Name of flux function being serialized. Options: cubic, burgers, lwr, buckley_leverett, expression
      * @param solver Name of the solving scheme to use.
      * @param discretization_size Size of the discretization being serialized.
      * @param num_timesteps Number of timesteps to run simulation for.
@@ -30,7 +31,7 @@ struct SimulationConfig {
      * @param delta_t timestep
      */
     SimulationConfig(
-        std::string domain, std::string flux, std::string solver, uint32_t discretization_size, uint32_t num_timesteps, double delta_x, double delta_t):
+        std::string domain, std::string flux, std::string solver, uint64_t discretization_size, uint64_t num_timesteps, double delta_x, double delta_t):
             domain(std::move(domain)),
             flux(std::move(flux)),
             solver(std::move(solver)),
@@ -52,6 +53,31 @@ struct SimulationConfig {
                 cereal::make_nvp("timesteps", num_timesteps),
                 cereal::make_nvp("delta_x", delta_x),
                 cereal::make_nvp("delta_t", delta_t));
+
+        // Grid options are optional, so configs written before nonuniform grids remain valid.
+        optional_nvp(archive, "width_source", width_source);
+        optional_nvp(archive, "width_file", width_file);
+        optional_nvp(archive, "refine_center", refine_center);
+        optional_nvp(archive, "refine_min_width", refine_min_width);
+        optional_nvp(archive, "refine_ratio", refine_ratio);
+        optional_nvp(archive, "boundary", boundary);
+        optional_nvp(archive, "boundary_left", boundary_left);
+        optional_nvp(archive, "boundary_right", boundary_right);
+        optional_nvp(archive, "convergence_period", convergence_period);
+        optional_nvp(archive, "convergence_tolerance", convergence_tolerance);
+        optional_nvp(archive, "divergence_guard", divergence_guard);
+        optional_nvp(archive, "divergence_width", divergence_width);
+        optional_nvp(archive, "divergence_nonfinite_cells", divergence_nonfinite_cells);
+        optional_nvp(archive, "limiter", limiter);
+        optional_nvp(archive, "rk_order", rk_order);
+        optional_nvp(archive, "riemann_flux", riemann_flux);
+        optional_nvp(archive, "local_time_stepping", local_time_stepping);
+        optional_nvp(archive, "amr_scheme", amr_scheme);
+        optional_nvp(archive, "amr_criterion", amr_criterion);
+        optional_nvp(archive, "amr_threshold", amr_threshold);
+        optional_nvp(archive, "amr_max_level", amr_max_level);
+        optional_nvp(archive, "amr_regrid_interval", amr_regrid_interval);
+        optional_nvp(archive, "flux_expression", flux_expression);
     }
 
     /*
@@ -60,12 +86,148 @@ struct SimulationConfig {
     std::string domain;
     std::string flux;
     std::string solver;
-    uint32_t discretization_size;
-    uint32_t num_timesteps;
+    uint64_t discretization_size;
+    uint64_t num_timesteps;
     double delta_t;
     double delta_x;
+
+    /*
+     * Width of each control volume, for finite volume solvers. Width sources:
+     * - uniform: every cell has width delta_x.
+     * - file: widths are read from width_file.
+     * - geometric: cells are refined around cell refine_center. The center has width refine_min_width,
+     *   and widths grow by a factor of refine_ratio per cell away from it, up to delta_x.
+     */
+    std::string width_source = "uniform";
+    std::string width_file;
+    uint64_t refine_center = 0;
+    double refine_min_width = 0;
+    double refine_ratio = 1;
+
+    /*
+     * Condition at both edges of the system. Options: periodic, outflow, reflective, dirichlet.
+     * Dirichlet boundaries hold boundary_left and boundary_right outside the left and right edges.
+     */
+    std::string boundary = "periodic";
+    double boundary_left = 0;
+    double boundary_right = 0;
+
+    /*
+     * Stop early once the solution settles into a cycle of at most convergence_period timesteps, 0 to never stop early.
+     * Real states repeat if each cell is within the relative convergence_tolerance of the earlier cell.
+     * Interval states repeat only if each cell is contained in the earlier cell. Unsupported for affine and mixed forms.
+     */
+    uint64_t convergence_period = 0;
+    double convergence_tolerance = 1e-12;
+
+    /*
+     * If divergence_guard is set, abort once any cell grows wider than divergence_width (0 for no limit),
+     * or more than divergence_nonfinite_cells cells of a row have NaN or infinite bounds.
+     */
+    bool divergence_guard = false;
+    double divergence_width = 0;
+    uint64_t divergence_nonfinite_cells = 0;
+
+    /*
+     * Options for the higher order solvers, muscl and weno5. Ignored by other solvers.
+     * limiter reconstructs slopes for muscl, options: minmod, van_leer.
+     * rk_order is the order of SSP Runge-Kutta, 2 or 3, or 0 for the default of the scheme.
+     */
+    std::string limiter = "minmod";
+    uint32_t rk_order = 0;
+
+    /*
+     * Numerical flux of the riemann solver. Options: godunov, hll.
+     */
+    std::string riemann_flux = "godunov";
+
+    /*
+     * Step each cell of a nonuniform grid at a power-of-two fraction of delta_t suited to its width,
+     * so delta_t only needs to satisfy the CFL condition for the widest cells.
+     * Supported by the first order finite volume solvers, local_lax_friedrichs and riemann.
+     */
+    bool local_time_stepping = false;
+
+    /*
+     * Options for adaptive mesh refinement, the amr solver. Ignored by other solvers.
+     * Each cell of the grid is split into up to 2^amr_max_level cells where amr_criterion exceeds amr_threshold,
+     * and advanced with the finite volume solver amr_scheme, regridding every amr_regrid_interval timesteps.
+     * Criteria: gradient, the jump between neighboring cells, or width, the width of enclosures.
+     */
+    std::string amr_scheme = "riemann";
+    std::string amr_criterion = "gradient";
+    double amr_threshold = 0.1;
+    uint32_t amr_max_level = 2;
+    uint64_t amr_regrid_interval = 4;
+
+    /*
+     * Flux of the expression flux, in u, i.e. "u * (1 - u)". Ignored by other fluxes.
+     * Supports numbers, +, -, *, /, parentheses, and ^ with constant integer exponents.
+     */
+    std::string flux_expression;
+
+private:
+    /**
+     * Serialize a field which may be missing from the input.
+     * Missing fields keep their default values.
+     */
+    template<class Archive, typename V>
+    static void optional_nvp(Archive &archive, const char *name, V &value) {
+        if constexpr (Archive::is_loading::value) {
+            try {
+                archive(cereal::make_nvp(name, value));
+            } catch (const cereal::Exception &) {}
+        } else {
+            archive(cereal::make_nvp(name, value));
+        }
+    }
 };
 
+/**
+ * @brief Fingerprint a configuration, i.e. to verify that a checkpoint belongs to the same simulation.
+ * Uses FNV-1a, which is stable between runs and platforms, unlike std::hash.
+ *
+ * @param config Configuration to fingerprint.
+ * @return A 64 bit hash of every field of the configuration.
+ */
+inline uint64_t config_hash(const SimulationConfig &config) {
+    uint64_t hash = 0xcbf29ce484222325;
+    auto mix = [&hash](const void *data, size_t size) {
+        auto bytes = static_cast<const unsigned char *>(data);
+        for (size_t i = 0; i < size; i++) {
+            hash = (hash ^ bytes[i]) * 0x100000001b3;
+        }
+    };
+
+    // Hash lengths as well as strings, so adjacent fields cannot alias.
+    for (const auto &field : {config.domain, config.flux, config.solver, config.width_source, config.width_file, config.boundary,
+        config.limiter, config.riemann_flux, config.amr_scheme, config.amr_criterion, config.flux_expression}) {
+        auto size = field.size();
+        mix(&size, sizeof(size));
+        mix(field.data(), size);
+    }
+    mix(&config.discretization_size, sizeof(config.discretization_size));
+    mix(&config.num_timesteps, sizeof(config.num_timesteps));
+    mix(&config.delta_t, sizeof(config.delta_t));
+    mix(&config.delta_x, sizeof(config.delta_x));
+    mix(&config.refine_center, sizeof(config.refine_center));
+    mix(&config.refine_min_width, sizeof(config.refine_min_width));
+    mix(&config.refine_ratio, sizeof(config.refine_ratio));
+    mix(&config.boundary_left, sizeof(config.boundary_left));
+    mix(&config.boundary_right, sizeof(config.boundary_right));
+    mix(&config.convergence_period, sizeof(config.convergence_period));
+    mix(&config.convergence_tolerance, sizeof(config.convergence_tolerance));
+    mix(&config.divergence_guard, sizeof(config.divergence_guard));
+    mix(&config.divergence_width, sizeof(config.divergence_width));
+    mix(&config.divergence_nonfinite_cells, sizeof(config.divergence_nonfinite_cells));
+    mix(&config.rk_order, sizeof(config.rk_order));
+    mix(&config.local_time_stepping, sizeof(config.local_time_stepping));
+    mix(&config.amr_threshold, sizeof(config.amr_threshold));
+    mix(&config.amr_max_level, sizeof(config.amr_max_level));
+    mix(&config.amr_regrid_interval, sizeof(config.amr_regrid_interval));
+    return hash;
+}
+
 /*
  * io
  */
@@ -0,0 +1,140 @@
+//
+// Created by will on 12/3/25.
+//
+
+#ifndef PDENCLOSE_WIDTHVALUES_H
+#define PDENCLOSE_WIDTHVALUES_H
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "SimulationConfig.hpp"
+
+#include "cereal/archives/json.hpp"
+#include "cereal/types/vector.hpp"
+
+/*
+ * Control volume widths for nonuniform finite volume grids.
+ */
+
+/**
+ * @brief Geometrically refine a grid around a single cell, i.e. where a shock is expected to form.
+ *
+ * @param discretization_size Number of control volume cells.
+ * @param max_width Width of the coarsest cells, > 0.
+ * @param min_width Width of the center cell, in (0, max_width].
+ * @param ratio Growth in width per cell away from the center, >= 1.
+ * @param center Index of the most refined cell.
+ * @return The width of each cell.
+ */
+inline std::vector<double> geometric_widths(uint64_t discretization_size, double max_width, double min_width, double ratio, uint64_t center) {
+    assert(max_width > 0 && max_width < INFINITY);
+    assert(min_width > 0 && min_width <= max_width);
+    assert(ratio >= 1);
+    assert(center < discretization_size);
+
+    auto widths = std::vector<double>(discretization_size);
+    for (uint64_t x = 0; x < discretization_size; x++) {
+        auto distance = std::abs(static_cast<int64_t>(x) - static_cast<int64_t>(center));
+        widths[x] = std::min(max_width, min_width * std::pow(ratio, distance));
+    }
+    return widths;
+}
+
+/**
+ * @param file_name Name of file to read widths from.
+ * @return A vector of widths, read from file_name. Exits if the file cannot be read.
+ */
+inline std::vector<double> read_width_values(const std::string &file_name) {
+    std::ifstream f;
+    f.open(file_name);
+    if (!f.is_open()) {
+        std::cerr << "Could not open width file " << file_name << "!" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+
+    auto widths = std::vector<double>();
+    try {
+        cereal::JSONInputArchive archive(f);
+        archive(widths);
+    } catch (const cereal::Exception &) {
+        std::cerr << "Could not parse width file " << file_name << "!" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+
+    f.close();
+    return widths;
+}
+
+/**
+ * @param file_name Name of file to write widths to.
+ * @param widths Widths to write.
+ */
+inline void write_width_values(const std::string &file_name, const std::vector<double> &widths) {
+    std::ofstream f;
+    f.open(file_name);
+    {
+        cereal::JSONOutputArchive archive(f);
+        archive(widths);
+    }
+    f.close();
+}
+
+/**
+ * @brief Build the grid described by a configuration.
+ * Exits if the width source is unknown or its options are invalid,
+ * or if the widths do not match the size of the discretization or are not all positive and finite.
+ *
+ * @param config Configuration to build grid for.
+ * @return The width of each control volume cell.
+ */
+inline std::vector<double> width_values(const SimulationConfig &config) {
+    auto widths = std::vector<double>();
+    if (config.width_source == "uniform") {
+        widths = std::vector<double>(config.discretization_size, config.delta_x);
+    } else if (config.width_source == "file") {
+        widths = read_width_values(config.width_file);
+    } else if (config.width_source == "geometric") {
+        if (!(config.delta_x > 0 && config.delta_x < INFINITY)) {
+            std::cerr << "Geometric grids require a positive, finite delta_x!" << std::endl;
+            exit(EXIT_FAILURE);
+        }
+        if (!(config.refine_min_width > 0 && config.refine_min_width <= config.delta_x)) {
+            std::cerr << "Geometric grids require refine_min_width in (0, delta_x]!" << std::endl;
+            exit(EXIT_FAILURE);
+        }
+        if (!(config.refine_ratio >= 1 && config.refine_ratio < INFINITY)) {
+            std::cerr << "Geometric grids require a finite refine_ratio of at least 1!" << std::endl;
+            exit(EXIT_FAILURE);
+        }
+        if (config.refine_center >= config.discretization_size) {
+            std::cerr << "Geometric grids require refine_center within the discretization!" << std::endl;
+            exit(EXIT_FAILURE);
+        }
+        widths = geometric_widths(config.discretization_size, config.delta_x, config.refine_min_width,
+            config.refine_ratio, config.refine_center);
+    } else {
+        std::cerr << "Unsupported width source!" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+
+    if (widths.size() != config.discretization_size) {
+        std::cerr << "Number of widths does not match discretization size!" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    for (auto width : widths) {
+        if (!(width > 0 && width < INFINITY)) {
+            std::cerr << "Widths must be positive and finite!" << std::endl;
+            exit(EXIT_FAILURE);
+        }
+    }
+    return widths;
+}
+
+#endif //PDENCLOSE_WIDTHVALUES_H
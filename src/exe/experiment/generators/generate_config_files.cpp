@@ -17,9 +17,30 @@ void write_single_cfg(const std::string &domain_name, const std::string &solver_
     write_config(file_name, cfg);
 }
 
+/*
+ * Burgers initial conditions form a shock near the tail of the parabola, around cell 7.
+ * Refine the finite volume grid there, coarsening geometrically elsewhere.
+ */
+void write_refined_cfg(const std::string &domain_name, const std::string &root) {
+    auto discretization_size = 20;
+    auto num_timesteps = 25;
+    auto delta_x = 2;
+    // Finest cell is a quarter the standard width, so timestep shrinks accordingly to satisfy CFL.
+    auto timestep = 0.25;
+
+    auto cfg = SimulationConfig(domain_name, "burgers", "local_lax_friedrichs", discretization_size, num_timesteps, delta_x, timestep);
+    cfg.width_source = "geometric";
+    cfg.refine_center = 7;
+    cfg.refine_min_width = 0.5;
+    cfg.refine_ratio = 1.5;
+
+    auto file_name = root + "/" + domain_name + "_burgers_local_lax_friedrichs_refined_config.json";
+    write_config(file_name, cfg);
+}
+
 void generate_config_files(const std::string &root) {
     std::string domains[] = {"real", "interval", "affine", "mixed"};
-    std::string solvers[] = {"lax_friedrichs", "leapfrog" };
+    std::string solvers[] = {"lax_friedrichs", "leapfrog", "local_lax_friedrichs" };
 
     for (const auto& domain: domains) {
         for (const auto& solver: solvers) {
@@ -37,5 +58,6 @@ void generate_config_files(const std::string &root) {
             write_single_cfg(domain, solver, "cubic", cubic_timestep, root);
             write_single_cfg(domain, solver, "buckley_leverett", buckley_leverett_timestep, root);
         }
+        write_refined_cfg(domain, root);
     }
 }
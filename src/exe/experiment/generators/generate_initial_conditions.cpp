@@ -4,41 +4,81 @@
 
 #include "generate_initial_conditions.hpp"
 
+#include <cmath>
+
 #include "Caffeine/AffineForm.hpp"
 #include "domains/Real.hpp"
 #include "DualDomain/MixedForm.hpp"
 /*
- * Conversion function.
- * Convert original conditions to other types with tolerance 0.1.
+ * Widening functions.
+ * Each cell is independent, so conversion is split between threads.
  */
-std::vector<Winterval> convert_conds_to_interval(const std::vector<Real> &real_conds, double epsilon) {
+template<>
+std::vector<Real> widen_conditions<Real>(const std::vector<double> &values, double) {
+    // Reals cannot represent uncertainty, so the tolerance is dropped.
+    std::vector<Real> real_conds = std::vector<Real>(values.size());
+
+#   pragma omp parallel for default(none) shared(values, real_conds)
+    for (size_t i = 0; i < values.size(); i++) {
+        real_conds[i] = values[i];
+    }
+    return real_conds;
+}
+template<>
+std::vector<Winterval> widen_conditions<Winterval>(const std::vector<double> &values, double epsilon) {
     epsilon = std::abs(epsilon);
-    std::vector<Winterval> interval_conds = std::vector<Winterval>(real_conds.size());
+    std::vector<Winterval> interval_conds = std::vector<Winterval>(values.size());
 
-    for (int i = 0; i < real_conds.size(); i++) {
-        interval_conds[i] = Winterval(real_conds[i].value() - epsilon, real_conds[i].value() + epsilon);
+#   pragma omp parallel for default(none) shared(values, interval_conds, epsilon)
+    for (size_t i = 0; i < values.size(); i++) {
+        interval_conds[i] = Winterval(values[i] - epsilon, values[i] + epsilon);
     }
     return interval_conds;
 }
-std::vector<AffineForm> convert_conds_to_affine(const std::vector<Real> &real_conds, double epsilon) {
+template<>
+std::vector<AffineForm> widen_conditions<AffineForm>(const std::vector<double> &values, double epsilon) {
     epsilon = std::abs(epsilon);
-    std::vector<AffineForm> affine_conds = std::vector<AffineForm>(real_conds.size());
+    std::vector<AffineForm> affine_conds = std::vector<AffineForm>(values.size());
 
-    for (int i = 0; i < real_conds.size(); i++) {
-        affine_conds[i] = AffineForm(Winterval(real_conds[i].value() - epsilon, real_conds[i].value() + epsilon));
+#   pragma omp parallel for default(none) shared(values, affine_conds, epsilon)
+    for (size_t i = 0; i < values.size(); i++) {
+        affine_conds[i] = AffineForm(Winterval(values[i] - epsilon, values[i] + epsilon));
     }
     return affine_conds;
 }
-std::vector<MixedForm> convert_conds_to_mixed(const std::vector<Real> &real_conds, double epsilon) {
+template<>
+std::vector<MixedForm> widen_conditions<MixedForm>(const std::vector<double> &values, double epsilon) {
     epsilon = std::abs(epsilon);
-    std::vector<MixedForm> mixed_conds = std::vector<MixedForm>(real_conds.size());
+    std::vector<MixedForm> mixed_conds = std::vector<MixedForm>(values.size());
 
-    for (int i = 0; i < real_conds.size(); i++) {
-        mixed_conds[i] = MixedForm(Winterval(real_conds[i].value() - epsilon, real_conds[i].value() + epsilon));
+#   pragma omp parallel for default(none) shared(values, mixed_conds, epsilon)
+    for (size_t i = 0; i < values.size(); i++) {
+        mixed_conds[i] = MixedForm(Winterval(values[i] - epsilon, values[i] + epsilon));
     }
     return mixed_conds;
 }
 
+/*
+ * Conversion function.
+ * Convert original conditions to other types with tolerance 0.1.
+ */
+static std::vector<double> real_values(const std::vector<Real> &real_conds) {
+    std::vector<double> values = std::vector<double>(real_conds.size());
+    for (size_t i = 0; i < real_conds.size(); i++) {
+        values[i] = real_conds[i].value();
+    }
+    return values;
+}
+std::vector<Winterval> convert_conds_to_interval(const std::vector<Real> &real_conds, double epsilon) {
+    return widen_conditions<Winterval>(real_values(real_conds), epsilon);
+}
+std::vector<AffineForm> convert_conds_to_affine(const std::vector<Real> &real_conds, double epsilon) {
+    return widen_conditions<AffineForm>(real_values(real_conds), epsilon);
+}
+std::vector<MixedForm> convert_conds_to_mixed(const std::vector<Real> &real_conds, double epsilon) {
+    return widen_conditions<MixedForm>(real_values(real_conds), epsilon);
+}
+
 /*
  * Write initial conditions for different fluxes.
  */
@@ -53,6 +93,8 @@ void write_burgers_initial_conds(const std::string &root) {
         base_conds[i] = x < 15.01 ? -0.015 * x * (x - 15) : 0;
     }
     write_initial_conditions<Real>(root + "/burgers_real_conds.json", base_conds);
+    // Domain-independent compact form, widened on load.
+    write_tolerance_conditions(root + "/burgers_conds" + tolerance_conditions_extension, real_values(base_conds), tolerance);
 
     auto interval_conds = convert_conds_to_interval(base_conds, tolerance);
     write_initial_conditions<Winterval>(root + "/burgers_interval_conds.json", interval_conds);
@@ -74,6 +116,8 @@ void write_lwr_initial_conds(const std::string &root) {
         base_conds[i] = x < 15.01 ? -0.015 * x * (x - 15) : 0;
     }
     write_initial_conditions<Real>(root + "/lwr_real_conds.json", base_conds);
+    // Domain-independent compact form, widened on load.
+    write_tolerance_conditions(root + "/lwr_conds" + tolerance_conditions_extension, real_values(base_conds), tolerance);
 
     auto interval_conds = convert_conds_to_interval(base_conds, tolerance);
     write_initial_conditions<Winterval>(root + "/lwr_interval_conds.json", interval_conds);
@@ -95,6 +139,8 @@ void write_buckley_leverett_initial_conds(const std::string &root) {
         base_conds[i] = x < 15.01 ? -0.015 * x * (x - 15) : 0;
     }
     write_initial_conditions<Real>(root + "/buckley_leverett_real_conds.json", base_conds);
+    // Domain-independent compact form, widened on load.
+    write_tolerance_conditions(root + "/buckley_leverett_conds" + tolerance_conditions_extension, real_values(base_conds), tolerance);
 
     auto interval_conds = convert_conds_to_interval(base_conds, tolerance);
     write_initial_conditions<Winterval>(root + "/buckley_leverett_interval_conds.json", interval_conds);
@@ -116,6 +162,8 @@ void write_cubic_initial_conds(const std::string &root) {
         base_conds[i] = x < 15.01 ? -0.015 * x * (x - 15) : 0;
     }
     write_initial_conditions<Real>(root + "/cubic_real_conds.json", base_conds);
+    // Domain-independent compact form, widened on load.
+    write_tolerance_conditions(root + "/cubic_conds" + tolerance_conditions_extension, real_values(base_conds), tolerance);
 
     auto interval_conds = convert_conds_to_interval(base_conds, tolerance);
     write_initial_conditions<Winterval>(root + "/cubic_interval_conds.json", interval_conds);
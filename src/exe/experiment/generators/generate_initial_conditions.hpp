@@ -5,12 +5,30 @@
 #ifndef PDENCLOSE_GENERATE_INITIAL_CONDITIONS_H
 #define PDENCLOSE_GENERATE_INITIAL_CONDITIONS_H
 
+#include <cstdlib>
+#include <filesystem>
 #include <fstream>
+#include <iostream>
 #include <string>
 
+#include "cereal/archives/binary.hpp"
 #include "cereal/archives/json.hpp"
 #include "cereal/types/vector.hpp"
 #include "domains/Numeric.hpp"
+#include "domains/Real.hpp"
+#include "Caffeine/AffineForm.hpp"
+#include "DualDomain/MixedForm.hpp"
+#include "Winterval/Winterval.hpp"
+
+/*
+ * Initial conditions may be stored in one of three formats, distinguished by file extension:
+ * - .json: cereal JSON encoding of the conditions. Human readable, but slow to parse for large systems.
+ * - .bin: cereal binary encoding of the conditions.
+ * - .tol: Real values plus a tolerance, widened into the target domain on load.
+ *   This is the most compact, and is converted in parallel.
+ */
+const std::string binary_conditions_extension = ".bin";
+const std::string tolerance_conditions_extension = ".tol";
 
 /**
  * Write out source files for initial conditions for different simulations.
@@ -18,22 +36,100 @@
  */
 void generate_initial_conds(const std::string &root);
 
+/**
+ * @brief Widen real values into initial conditions of a numeric domain.
+ * Specialized for each supported domain. Conversion is done in parallel.
+ *
+ * @tparam T Numeric type of initial conditions.
+ * @param values Real values of the conditions.
+ * @param epsilon Tolerance to widen each value by. Ignored by domains which cannot represent uncertainty.
+ * @return A vector of the initial conditions, each enclosing [value - epsilon, value + epsilon].
+ */
+template<typename T>
+requires Numeric<T>
+std::vector<T> widen_conditions(const std::vector<double> &values, double epsilon);
+template<> std::vector<Real> widen_conditions<Real>(const std::vector<double> &values, double epsilon);
+template<> std::vector<Winterval> widen_conditions<Winterval>(const std::vector<double> &values, double epsilon);
+template<> std::vector<AffineForm> widen_conditions<AffineForm>(const std::vector<double> &values, double epsilon);
+template<> std::vector<MixedForm> widen_conditions<MixedForm>(const std::vector<double> &values, double epsilon);
+
+/**
+ * @param file_name Name of file to read real values and tolerance from.
+ * @param values Vector to place real values in.
+ * @return The tolerance of the conditions.
+ */
+inline double read_tolerance_conditions(const std::string &file_name, std::vector<double> &values) {
+    std::ifstream f;
+    f.open(file_name, std::ios::binary);
+    if (!f.is_open()) {
+        std::cerr << "Could not open initial conditions " << file_name << "!" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+
+    auto tolerance = 0.0;
+    try {
+        cereal::BinaryInputArchive archive(f);
+        archive(tolerance, values);
+    } catch (const cereal::Exception &e) {
+        std::cerr << "Malformed initial conditions " << file_name << ": " << e.what() << "!" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+
+    f.close();
+    return tolerance;
+}
+
+/**
+ * @param file_name Name of file to write real values and tolerance to.
+ * @param values Real values of the conditions.
+ * @param tolerance Tolerance to widen each value by when loaded.
+ */
+inline void write_tolerance_conditions(const std::string &file_name, const std::vector<double> &values, double tolerance) {
+    std::ofstream f;
+    f.open(file_name, std::ios::binary);
+    {
+        cereal::BinaryOutputArchive archive(f);
+        archive(tolerance, values);
+    }
+    f.close();
+}
+
 /**
  *
  * @tparam T Numeric type of initial conditions.
- * @param file_name Name of file to read initial conditions from.
+ * @param file_name Name of file to read initial conditions from. Format is chosen by extension.
  * @return A vector of the initial conditions, read from file_name.
  */
 template<typename T>
 requires Numeric<T>
 std::vector<T> read_initial_conditions(const std::string& file_name) {
+    auto extension = std::filesystem::path(file_name).extension().string();
+    if (extension == tolerance_conditions_extension) {
+        auto values = std::vector<double>();
+        auto tolerance = read_tolerance_conditions(file_name, values);
+        return widen_conditions<T>(values, tolerance);
+    }
+
+    auto binary = extension == binary_conditions_extension;
     std::ifstream f;
-    f.open(file_name);
+    f.open(file_name, binary ? std::ios::binary : std::ios::in);
+    if (!f.is_open()) {
+        std::cerr << "Could not open initial conditions " << file_name << "!" << std::endl;
+        exit(EXIT_FAILURE);
+    }
 
     auto initial_conds = std::vector<T>();
-    {
-        cereal::JSONInputArchive archive(f);
-        archive(initial_conds);
+    try {
+        if (binary) {
+            cereal::BinaryInputArchive archive(f);
+            archive(initial_conds);
+        } else {
+            cereal::JSONInputArchive archive(f);
+            archive(initial_conds);
+        }
+    } catch (const cereal::Exception &e) {
+        std::cerr << "Malformed initial conditions " << file_name << ": " << e.what() << "!" << std::endl;
+        exit(EXIT_FAILURE);
     }
 
     f.close();
@@ -43,15 +139,19 @@ std::vector<T> read_initial_conditions(const std::string& file_name) {
 /**
  *
  * @tparam T Numeric type of initial conditions
- * @param file_name name of file to write conditions to.
+ * @param file_name name of file to write conditions to. Written in binary if it has the binary extension, otherwise JSON.
  * @param initial_conds Initial conditions to write
  */
 template<typename T>
 requires Numeric<T>
 void write_initial_conditions(const std::string& file_name, const std::vector<T> &initial_conds) {
+    auto binary = std::filesystem::path(file_name).extension().string() == binary_conditions_extension;
     std::ofstream f;
-    f.open(file_name);
-    {
+    f.open(file_name, binary ? std::ios::binary : std::ios::out);
+    if (binary) {
+        cereal::BinaryOutputArchive archive(f);
+        archive(initial_conds);
+    } else {
         cereal::JSONOutputArchive archive(f);
         archive(initial_conds);
     }
@@ -1,34 +1,54 @@
 
+#include <fstream>
+#include <getopt.h>
+#include <memory>
+
+#ifdef PDENCLOSE_MPI
+#include <mpi.h>
+#endif
+
+#include "meshes/DomainDecomposition.hpp"
+#include "meshes/MeshCheckpoint.hpp"
 #include "meshes/RectangularMesh.hpp"
+#include "domains/NoiseSymbols.hpp"
 #include "domains/Real.hpp"
-#include "solvers/volume/LocalLaxFriedrichsSolver.hpp"
 #include "DualDomain/MixedForm.hpp"
 #include "experiment/SimulationConfig.hpp"
-#include "solvers/difference/LaxFriedrichsSolver.hpp"
+#include "experiment/WidthValues.hpp"
+#include "experiment/BoundaryConditions.hpp"
+#include "experiment/FluxFunctions.hpp"
+#include "experiment/SchemeOptions.hpp"
+#include "solvers/BoxSplitter.hpp"
+#include "solvers/ContainmentVerifier.hpp"
+#include "solvers/ConvergenceMonitor.hpp"
+#include "solvers/DivergenceGuard.hpp"
 #include "flux/BurgersFlux.hpp"
 #include "args/match_names.hpp"
 #include "experiment/generators/generate_initial_conditions.hpp"
 #include "experiment/generators/generate_source_files.h"
 #include "visualization/MeshVisualizer.hpp"
 
+/*
+ * Number of timesteps between checkpoints, when not specified by the user.
+ */
+const uint32_t default_checkpoint_interval = 1000;
+
 /**
  * Run a user-configured simulation
  * @param cfg_path Path to configuration file
- * @param initial_conds_path Path to string with initial conditions.
- * @param run_cfl whether to run a CFL check pass on the solution mesh after execution.
+ * @param options Options for this run, i.e. initial conditions and checkpointing.
  */
-void run_simulation(const std::string &cfg_path, const std::string &initial_conds_path, bool run_cfl);
+void run_simulation(const std::string &cfg_path, const RunOptions &options);
 /**
  *
  * @param argc Number of arguments
  * @param argv Argument vector
  * @param write_test Pointer to option about whether to write out a sanity test file.
- * @param run_cfl Pointer to option about whether to run CFL check after executing simulation.
  * @param cfg_path Pointer to string where path of discretization config will be placed.
- * @param initial_conds_path Pointer to string where path of initial conditions will be placed.
+ * @param options Pointer to options for the simulation run, i.e. initial conditions and checkpointing.
  * @return whether no invalid arguments were provided
  */
-static bool get_args(int argc, char *argv[], bool *write_test, bool *run_cfl, std::string *cfg_path, std::string *initial_conds_path);
+static bool get_args(int argc, char *argv[], bool *write_test, std::string *cfg_path, RunOptions *options);
 
 /**
  * Print usage information to stdout.
@@ -76,9 +96,8 @@ void show_acceptable_burgers() {
 // Note: for now, assume only real-valued.
 int main(int argc, char *argv[]) {
     std::string cfg_path = "";
-    std::string initial_conds_path = "";
     bool gen_sources = false;
-    bool run_cfl = false;
+    auto options = RunOptions{"", false, "", default_checkpoint_interval, false, 0, 0, ""};
 
     if (argc == 1) {
         std::cout << "No arguments provided, running sanity test." << std::endl;
@@ -89,7 +108,7 @@ int main(int argc, char *argv[]) {
     }
 
     // Read command line args.
-    if (!get_args(argc, argv, &gen_sources, &run_cfl, &cfg_path, &initial_conds_path)) {
+    if (!get_args(argc, argv, &gen_sources, &cfg_path, &options)) {
         std::cerr << "Invalid arguments." << std::endl;
         usage();
         exit(EXIT_FAILURE);
@@ -101,49 +120,128 @@ int main(int argc, char *argv[]) {
         usage();
         exit(EXIT_FAILURE);
     }
-    if (gen_sources && run_cfl) {
+    if (gen_sources && options.run_cfl) {
         std::cerr << "Cannot run CFL check when generating source files." << std::endl;
         usage();
         exit(EXIT_FAILURE);
     }
-    if (cfg_path.empty() != initial_conds_path.empty()) {
+    if (gen_sources && !options.checkpoint_path.empty()) {
+        std::cerr << "Cannot checkpoint when generating source files." << std::endl;
+        usage();
+        exit(EXIT_FAILURE);
+    }
+    if (options.resume && options.checkpoint_path.empty()) {
+        std::cerr << "Specify a checkpoint file to resume from." << std::endl;
+        usage();
+        exit(EXIT_FAILURE);
+    }
+    // Resumed simulations take their state from the checkpoint, not the initial conditions.
+    if (!options.resume && cfg_path.empty() != options.initial_conds_path.empty()) {
         std::cerr << "Specify both an initial conditions file and a configuration file." << std::endl;
         usage();
         exit(EXIT_FAILURE);
     }
+    if (options.boxes > 0 && (!options.checkpoint_path.empty() || options.run_cfl)) {
+        std::cerr << "Cannot checkpoint or run CFL check when splitting initial conditions." << std::endl;
+        usage();
+        exit(EXIT_FAILURE);
+    }
+
+#ifdef PDENCLOSE_MPI
+    int thread_support = 0;
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &thread_support);
+    int ranks = 1;
+    MPI_Comm_size(MPI_COMM_WORLD, &ranks);
+    // Each rank only holds its own span of the solution, so it is written out together rather than printed.
+    if (ranks > 1 && (gen_sources || options.run_cfl || !options.checkpoint_path.empty() || options.boxes > 0
+        || options.samples > 0 || options.output_path.empty())) {
+        std::cerr << "Distributed runs only support -c, -s, and -o, which is required." << std::endl;
+        usage();
+        abort_ranks();
+    }
+#endif
 
     if (gen_sources) {
         generate_source_files();
     } else {
-        run_simulation(cfg_path, initial_conds_path, run_cfl);
+        run_simulation(cfg_path, options);
     }
 
+#ifdef PDENCLOSE_MPI
+    MPI_Finalize();
+#endif
     return 0;
 }
 
 static void usage() {
-    std::cout << R"(Usage: "PDEnclose -w" OR "PDEnclose -c <config_path> -s <initial_conditions_path> [-t]")" << std::endl;
+    std::cout << R"(Usage: "PDEnclose -w" OR "PDEnclose -c <config_path> -s <initial_conditions_path> [-t] [-v <samples>] [-k <checkpoint_path> [-n <interval>]] [-o <output_path>]")" << std::endl;
+    std::cout << R"(       OR "PDEnclose -c <config_path> -k <checkpoint_path> --resume [-t] [-n <interval>] [-o <output_path>]")" << std::endl;
+    std::cout << R"(       OR "PDEnclose -c <config_path> -s <initial_conditions_path> -b <boxes> [-v <samples>] [-o <output_path>]")" << std::endl;
+    std::cout << R"(       OR "mpirun -np <ranks> PDEnclose -c <config_path> -s <initial_conditions_path> -o <output_path>", if built with PDENCLOSE_MPI)" << std::endl;
     std::cout << "\t-w: Write out source files for testing." << std::endl;
     std::cout << "\t-c: Path to configuration file." << std::endl;
     std::cout << "\t-s: Path to initial conditions file." << std::endl;
     std::cout << "\t-t: (Optional) Run CFL check after simulation." << std::endl;
+    std::cout << "\t-k, --checkpoint: (Optional) Path to periodically checkpoint the simulation to." << std::endl;
+    std::cout << "\t-n, --checkpoint-interval: (Optional) Timesteps between checkpoints. Default: " << default_checkpoint_interval << std::endl;
+    std::cout << "\t-r, --resume: (Optional) Continue an interrupted simulation from its checkpoint." << std::endl;
+    std::cout << "\t-v, --verify: (Optional) Check this many sampled real solutions against the enclosure, reporting any escapes." << std::endl;
+    std::cout << "\t-b, --boxes: (Optional) Split the initial uncertainty into this many sub-boxes, printing the hull of their solutions." << std::endl;
+    std::cout << "\t-o, --output: (Optional) Write the solution to this path instead of printing it. Required by distributed runs." << std::endl;
 }
 
-static bool get_args(int argc, char *argv[], bool *write_test, bool *run_cfl, std::string *cfg_path, std::string *initial_conds_path) {
+static bool get_args(int argc, char *argv[], bool *write_test, std::string *cfg_path, RunOptions *options) {
+    static option long_options[] = {
+        {"checkpoint", required_argument, nullptr, 'k'},
+        {"checkpoint-interval", required_argument, nullptr, 'n'},
+        {"resume", no_argument, nullptr, 'r'},
+        {"boxes", required_argument, nullptr, 'b'},
+        {"verify", required_argument, nullptr, 'v'},
+        {"output", required_argument, nullptr, 'o'},
+        {nullptr, 0, nullptr, 0}
+    };
+
     int ch = 0;
-    while ((ch = getopt(argc, argv, "wtc:s:")) != -1) {
+    while ((ch = getopt_long(argc, argv, "wtc:s:k:n:rb:v:o:", long_options, nullptr)) != -1) {
         switch (ch) {
             case 'w':
                 *write_test = true;
                 break;
             case 's':
-                *initial_conds_path = optarg;
+                options->initial_conds_path = optarg;
                 break;
             case 'c':
                 *cfg_path = optarg;
                 break;
             case 't':
-                *run_cfl = true;
+                options->run_cfl = true;
+                break;
+            case 'k':
+                options->checkpoint_path = optarg;
+                break;
+            case 'n':
+                options->checkpoint_interval = std::strtoul(optarg, nullptr, 10);
+                if (options->checkpoint_interval == 0) {
+                    return false;
+                }
+                break;
+            case 'r':
+                options->resume = true;
+                break;
+            case 'b':
+                options->boxes = std::strtoul(optarg, nullptr, 10);
+                if (options->boxes == 0) {
+                    return false;
+                }
+                break;
+            case 'v':
+                options->samples = std::strtoull(optarg, nullptr, 10);
+                if (options->samples == 0) {
+                    return false;
+                }
+                break;
+            case 'o':
+                options->output_path = optarg;
                 break;
             default:
                 return false;
@@ -152,39 +250,219 @@ static bool get_args(int argc, char *argv[], bool *write_test, bool *run_cfl, st
     return true;
 }
 
-template<typename T>
-requires Numeric<T>
-void run_simulation_internal(const SimulationConfig &config, const std::string &initial_conds_path, bool run_cfl) {
-    auto initial_conditions = read_initial_conditions<T>(initial_conds_path);
-    auto flux = match_flux<T>(config.flux);
-    // For now, only difference solvers.
-    auto solver = match_difference<T>(config.solver);
-    auto solution = solver->solve(initial_conditions, config.discretization_size, config.num_timesteps, config.delta_t, config.delta_x, flux);
-    solution.print_system();
+/**
+ * Simulation specialized for one domain, flux function, and solver.
+ * Instantiated for every registered combination -- see match_names.hpp.
+ */
+template<typename T, typename F, typename S>
+struct SimulationRun {
+    static constexpr bool volume = std::derived_from<S, VolumeSolver<T, F>>;
+
+    static void run(const SimulationConfig &config, const RunOptions &options) {
+        auto flux = flux_function<F>(config);
+        auto boundary = boundary_condition<T>(config);
+        if (config.convergence_period > 0 && !ConvergenceMonitor<T>::supported) {
+            std::cerr << "Stopping early is not supported for the " << config.domain << " domain!" << std::endl;
+            exit(EXIT_FAILURE);
+        }
+        auto monitor = config.convergence_period > 0
+            ? std::make_shared<ConvergenceMonitor<T>>(config.convergence_period, config.convergence_tolerance)
+            : nullptr;
+        auto guard = config.divergence_guard
+            ? std::make_shared<DivergenceGuard<T>>(config.divergence_width, config.divergence_nonfinite_cells)
+            : nullptr;
+        // Solvers record the outcome of their last solve, so concurrent solves each need their own.
+        auto make_solver = [&]() {
+            auto solver = S();
+            apply_scheme_options(solver, config);
+            solver.set_boundary(boundary);
+            solver.set_convergence_monitor(monitor);
+            solver.set_divergence_guard(guard);
+            return solver;
+        };
+        auto solver = make_solver();
+        auto checkpoint = options.checkpoint_path.empty()
+            ? nullptr
+            : std::make_unique<MeshCheckpoint<T>>(options.checkpoint_path, config_hash(config), options.checkpoint_interval);
+
+        // Finite volume solvers take a width per cell in place of delta_x.
+        auto width_values = std::vector<double>();
+        if constexpr (volume) {
+            width_values = ::width_values(config);
+        } else if (config.width_source != "uniform") {
+            std::cerr << "Finite difference solvers only support uniform grids!" << std::endl;
+            exit(EXIT_FAILURE);
+        }
+
+#ifdef PDENCLOSE_MPI
+        int ranks = 1;
+        MPI_Comm_size(MPI_COMM_WORLD, &ranks);
+        if (ranks > 1) {
+            run_distributed(solver, config, options, width_values, &flux, boundary);
+            return;
+        }
+#endif
+
+        // Generic over domain, so the same scheme can also be solved over batched reals.
+        auto solve = [&](auto &solver, const auto &initial_state, auto *flux, auto *checkpoint) {
+            if constexpr (volume) {
+                return solver.solve(initial_state, width_values, config.discretization_size, config.num_timesteps,
+                    config.delta_t, flux, checkpoint);
+            } else {
+                return solver.solve(initial_state, config.discretization_size, config.num_timesteps,
+                    config.delta_t, config.delta_x, flux, checkpoint);
+            }
+        };
+
+        if (options.boxes > 0) {
+            auto hull = BoxSplitter<T>(options.boxes).solve(read_initial_conditions<T>(options.initial_conds_path),
+                [&](const std::vector<T> &initial_state) {
+                    auto box_solver = make_solver();
+                    return solve(box_solver, initial_state, &flux, static_cast<MeshCheckpoint<T> *>(nullptr));
+                });
+            output(hull, options);
+            verify(config, options, hull, solve);
+            return;
+        }
+
+        // Volume solvers check the CFL condition as they go, unless rows are restored from a checkpoint.
+        auto track_cfl = volume && options.run_cfl && !options.resume;
+        if constexpr (volume) {
+            solver.track_cfl(track_cfl);
+        }
+
+        auto solution = options.resume
+            ? resume(solver, config, width_values, &flux, checkpoint.get())
+            : solve(solver, read_initial_conditions<T>(options.initial_conds_path), &flux, checkpoint.get());
+        output(solution, options);
+        if (auto convergence = solver.convergence()) {
+            std::cout << "Converged at timestep " << convergence->timestep << " with period " << convergence->period << std::endl;
+        }
+        if (auto divergence = solver.divergence()) {
+            divergence->print();
+        }
 
-    if (run_cfl) {
-        solver->cfl_check_mesh(solution, flux, config.delta_t, config.delta_x);
+        if (options.run_cfl) {
+            if constexpr (volume) {
+                if (track_cfl) {
+                    solver.tracked_cfl_check();
+                } else {
+                    // Locally stepped cells take their own step, so are checked at the width it corresponds to.
+                    auto cfl_widths = config.local_time_stepping ? TimeLevels(width_values).step_widths() : width_values;
+                    solver.cfl_check_mesh(solution, &flux, config.delta_t, cfl_widths);
+                }
+            } else {
+                solver.cfl_check_mesh(solution, &flux, config.delta_t, config.delta_x);
+            }
+        }
+        verify(config, options, solution, solve);
     }
 
-    delete solver;
-    delete flux;
-}
+    static RectangularMesh<T> resume(S &solver, const SimulationConfig &config, const std::vector<double> &width_values,
+        F *flux, MeshCheckpoint<T> *checkpoint) {
+        if constexpr (volume) {
+            return solver.resume(width_values, config.discretization_size, config.num_timesteps, config.delta_t, flux, checkpoint);
+        } else {
+            return solver.resume(config.discretization_size, config.num_timesteps, config.delta_t, config.delta_x, flux, checkpoint);
+        }
+    }
+
+    /**
+     * @brief Print a solution, or write it out if given an output path.
+     */
+    template<typename E>
+    static void output(const RectangularMesh<E> &solution, const RunOptions &options) {
+        if (options.output_path.empty()) {
+            solution.print_system();
+            return;
+        }
+        std::ofstream f(options.output_path);
+        if (!f) {
+            std::cerr << "Could not open " << options.output_path << " for writing!" << std::endl;
+            exit(EXIT_FAILURE);
+        }
+        solution.print_system(f);
+    }
+
+#ifdef PDENCLOSE_MPI
+    /**
+     * @brief Solve this rank's span of the grid, exchanging halos with neighboring ranks, then write out every rank's rows.
+     */
+    static void run_distributed(S &solver, const SimulationConfig &config, const RunOptions &options,
+        const std::vector<double> &width_values, F *flux, const std::shared_ptr<BoundaryCondition<T>> &boundary) {
+        // Symbols allocated on different ranks may collide, which would wrongly correlate forms meeting across ranks.
+        if constexpr (NoiseSymbols<T>::allocated) {
+            std::cerr << "Distributed runs only support domains without noise symbols!" << std::endl;
+            abort_ranks();
+        } else {
+            // Halos are exchanged at every ghost fill, so every rank must take the same steps.
+            if (config.local_time_stepping || config.convergence_period > 0 || config.divergence_guard
+                || std::same_as<S, AdaptiveSolver<T, F>>) {
+                std::cerr << "Distributed runs cannot step locally, refine adaptively, or stop early!" << std::endl;
+                abort_ranks();
+            }
+            int ranks = 1;
+            MPI_Comm_size(MPI_COMM_WORLD, &ranks);
+            if (config.discretization_size < static_cast<uint64_t>(ranks)) {
+                std::cerr << "Cannot split " << config.discretization_size << " cells between " << ranks << " ranks!" << std::endl;
+                abort_ranks();
+            }
+            auto decomposition = DomainDecomposition::world(config.discretization_size);
+            solver.set_boundary(std::make_shared<HaloBoundary<T>>(boundary, decomposition));
+
+            // Every rank reads the initial conditions, then keeps its own span.
+            auto initial_state = read_initial_conditions<T>(options.initial_conds_path);
+            if (initial_state.size() != config.discretization_size) {
+                std::cerr << "Initial conditions do not match the discretization size!" << std::endl;
+                abort_ranks();
+            }
+            auto begin = static_cast<int64_t>(decomposition.begin());
+            auto end = static_cast<int64_t>(decomposition.end());
+            auto local_state = std::vector<T>(initial_state.begin() + begin, initial_state.begin() + end);
+            auto solution = [&]() {
+                if constexpr (volume) {
+                    auto local_widths = std::vector<double>(width_values.begin() + begin, width_values.begin() + end);
+                    return solver.solve(local_state, local_widths, decomposition.size(), config.num_timesteps, config.delta_t, flux);
+                } else {
+                    return solver.solve(local_state, decomposition.size(), config.num_timesteps, config.delta_t, config.delta_x, flux);
+                }
+            }();
+            write_distributed_system(solution, decomposition, options.output_path);
+        }
+    }
+#endif
+
+    /**
+     * @brief If requested, check sampled real solutions of this scheme against an enclosure, printing the report.
+     */
+    template<typename E, typename Solve>
+    static void verify(const SimulationConfig &config, const RunOptions &options, const RectangularMesh<E> &enclosure, Solve &solve) {
+        if (options.samples == 0) {
+            return;
+        }
 
-void run_simulation(const std::string &cfg_path, const std::string &initial_conds_path, bool run_cfl) {
+        using Verifier = ContainmentVerifier<>;
+        using Batch = Verifier::Batch;
+        auto report = Verifier(options.samples).verify(enclosure, [&](const std::vector<Batch> &initial_state) {
+            auto flux = flux_function<typename RebindDomain<F, Batch>::type>(config);
+            auto solver = typename RebindDomain<S, Batch>::type();
+            apply_scheme_options(solver, config);
+            solver.set_boundary(boundary_condition<Batch>(config));
+            return solve(solver, initial_state, &flux, static_cast<MeshCheckpoint<Batch> *>(nullptr));
+        });
+        report.print();
+    }
+};
+
+void run_simulation(const std::string &cfg_path, const RunOptions &options) {
     // Read config
     auto config = read_config(cfg_path);
 
-    // Note: duplicated logic between these branches because we can only initialize once we know the templated type.
-    if (config.domain == "real") {
-        run_simulation_internal<Real>(config, initial_conds_path, run_cfl);
-    } else if (config.domain == "interval") {
-        run_simulation_internal<Winterval>(config, initial_conds_path, run_cfl);
-    } else if (config.domain == "affine") {
-        run_simulation_internal<AffineForm>(config, initial_conds_path, run_cfl);
-    } else if (config.domain == "mixed") {
-        run_simulation_internal<MixedForm>(config, initial_conds_path, run_cfl);
-    } else {
-        std::cerr << "Invalid domain!" << std::endl;
+    // Resolve the specialized simulation once, up front.
+    auto runner = match_simulation<SimulationRun>(config);
+    if (!runner) {
+        std::cerr << "Unsupported combination of domain, flux function, and solver!" << std::endl;
         exit(EXIT_FAILURE);
     }
+    runner(config, options);
 }
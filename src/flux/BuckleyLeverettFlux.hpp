@@ -5,41 +5,49 @@
 #ifndef PDENCLOSE_BUCKLEYLEVERETTFLUX_H
 #define PDENCLOSE_BUCKLEYLEVERETTFLUX_H
 #include "FluxFunction.hpp"
+#include "domains/LinearCombination.hpp"
 #include "domains/Numeric.hpp"
 
 template<typename T>
 requires Numeric<T>
 class BuckleyLeverett final : public FluxFunction<T> {
 public:
+    static constexpr auto name = "buckley_leverett";
+
     /**
      * x^2 / ((x^2) + (1/4 (1 - x)^2)
      * @param value value to substitute in for x. We will derive from the underlying discretization, the S function in formal notation.
      * @return the result of invoking the flux function with value.
      */
-    T flux(T value) override {
+    T flux(const T &value) override {
         // Using intermediate value to avoid introducing new noise symbols.
         auto squared = value.pow(2);
-        return squared / (squared + (value * -1 + 1).pow(2) * 0.25);
+        T complement = scaled(value, -1) + 1;
+        return squared / (scaled(complement.pow(2), 0.25) + squared);
     }
 
     /**
-     * Numerator: -8x^2 - x
-     * Denominator: (5x^2 -2x +1)^2 = 25x^4 - 20x^3 + 14x^2 - 4x + 1
+     * x(1 - x) / (2 (x^2 + 1/4 (1 - x)^2)^2)
+     * The denominator is the square of the flux's denominator, so the two can share it.
      * @param value Value to substittue in for x.
-     * @return the result of invoking the flux function with value.
+     * @return the result of invoking the derivative of the flux function with value.
      */
-    T derivative_flux(T value) override {
-        // Manually computing powers wrt each other to maintain noise symbols between different forms.
-        // Additionally, the fast descent of affine squaring has minimal benefit at a low power such as four.
-
-        auto squared = value * value;
-        auto cubed = squared * value;
-        auto fourth = cubed * value;
+    T derivative_flux(const T &value) override {
+        T complement = scaled(value, -1) + 1;
+        T denom = scaled(complement.pow(2), 0.25) + value.pow(2);
+        return value * complement * 0.5 / denom.pow(2);
+    }
 
-        auto numer = squared * -8 - value;
-        auto denom = fourth * 25 - cubed * 20 + squared * 14 - value * 4 + 1;
+    FluxEvaluation<T> flux_with_derivative(const T &value) override {
+        auto squared = value.pow(2);
+        T complement = scaled(value, -1) + 1;
+        T denom = scaled(complement.pow(2), 0.25) + squared;
+        return {squared / denom, value * complement * 0.5 / denom.pow(2)};
+    }
 
-        return numer / denom;
+    // The derivative's numerator is x(1 - x), and its denominator never vanishes.
+    std::vector<double> stationary_points() const override {
+        return {0, 1};
     }
 };
 
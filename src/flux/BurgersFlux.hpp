@@ -11,12 +11,20 @@ template<typename T>
 requires Numeric<T>
 class BurgersFlux final : public FluxFunction<T> {
 public:
-    T flux(T value) override {
+    static constexpr auto name = "burgers";
+
+    T flux(const T &value) override {
         return value.pow(2) * 0.5;
     }
-    T derivative_flux(T value) override {
+    T derivative_flux(const T &value) override {
         return value;
     }
+    FluxEvaluation<T> flux_with_derivative(const T &value) override {
+        return {value.pow(2) * 0.5, value};
+    }
+    std::vector<double> stationary_points() const override {
+        return {0};
+    }
 };
 
 #endif //PDENCLOSE_BURGERSFLUX_H
\ No newline at end of file
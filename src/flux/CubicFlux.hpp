@@ -15,11 +15,21 @@ template<typename T>
 requires Numeric<T>
 class CubicFlux final : public FluxFunction<T> {
 public:
-    T flux(T value) override {
+    static constexpr auto name = "cubic";
+
+    T flux(const T &value) override {
         return value.pow(3);
     }
-    T derivative_flux(T value) override {
+    T derivative_flux(const T &value) override {
         return value.pow(2) * 3;
     }
+    FluxEvaluation<T> flux_with_derivative(const T &value) override {
+        // Cubing the shared square would widen intervals straddling zero, so only dispatch is saved here.
+        return {value.pow(3), value.pow(2) * 3};
+    }
+    // An inflection rather than an extremum, but the derivative does vanish there.
+    std::vector<double> stationary_points() const override {
+        return {0};
+    }
 };
 #endif //PDENCLOSE_CUBICFLUX_H
\ No newline at end of file
@@ -0,0 +1,875 @@
+//
+// Created by will on 12/10/25.
+//
+
+#ifndef PDENCLOSE_EXPRESSIONFLUX_H
+#define PDENCLOSE_EXPRESSIONFLUX_H
+#include <algorithm>
+#include <cassert>
+#include <cctype>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "FluxFunction.hpp"
+#include "domains/Enclosure.hpp"
+#include "domains/LinearCombination.hpp"
+#include "domains/Numeric.hpp"
+
+/**
+ * Flux function of u, parsed from an expression at runtime, i.e. "u * (1 - u)" for LWR.
+ *
+ * Expressions are built from u, numbers, +, -, *, /, parentheses, and ^ with a constant, non-negative integer exponent.
+ * They are parsed once into a graph of unique subexpressions, with constants folded and trivial operations removed.
+ * The derivative is taken symbolically over the same graph, so the flux and its derivative share subexpressions.
+ * Then, the graph is compiled to a short register program, with registers reused once their values are dead.
+ *
+ * Constants are folded in double precision, as if the folded value were written in the expression.
+ * Otherwise, every operation is carried out in the numeric domain, so enclosures stay sound.
+ */
+class FluxExpression {
+public:
+    /*
+     * Program
+     */
+
+    enum class Opcode : uint8_t {
+        // destination = c
+        constant,
+        // destination = left op right
+        add,
+        subtract,
+        multiply,
+        divide,
+        // destination = left op c
+        add_constant,
+        subtract_constant,
+        multiply_constant,
+        divide_constant,
+        // destination = c - left
+        constant_subtract,
+        // destination = left ^ power
+        power,
+    };
+
+    struct Instruction {
+        Opcode op;
+        uint16_t destination;
+        uint16_t left;
+        uint16_t right;
+        uint32_t power;
+        double constant;
+    };
+
+    /**
+     * Straight line program over registers. Register 0 starts as u.
+     */
+    struct Program {
+        std::vector<Instruction> instructions;
+        uint16_t num_registers = 1;
+        // Register holding each output once the program finishes.
+        std::vector<uint16_t> outputs;
+
+        /**
+         * @param value Value of u.
+         * @param registers At least num_registers registers.
+         */
+        template<typename T>
+        requires Numeric<T>
+        void execute(const T &value, T *registers) const {
+            registers[0] = value;
+            for (const auto &instruction : instructions) {
+                auto &destination = registers[instruction.destination];
+                const auto &left = registers[instruction.left];
+                const auto &right = registers[instruction.right];
+                switch (instruction.op) {
+                    case Opcode::constant:
+                        // Built from bounds rather than offset from a zeroed u, as 0 * u is NaN for unbounded u.
+                        destination = Enclosure<T>::from_bounds(instruction.constant, instruction.constant);
+                        break;
+                    case Opcode::add:
+                        destination = left + right;
+                        break;
+                    case Opcode::subtract:
+                        destination = left - right;
+                        break;
+                    case Opcode::multiply:
+                        destination = left * right;
+                        break;
+                    case Opcode::divide:
+                        destination = left / right;
+                        break;
+                    case Opcode::add_constant:
+                        destination = left + instruction.constant;
+                        break;
+                    case Opcode::subtract_constant:
+                        destination = left - instruction.constant;
+                        break;
+                    case Opcode::multiply_constant:
+                        destination = left * instruction.constant;
+                        break;
+                    case Opcode::divide_constant:
+                        destination = left / instruction.constant;
+                        break;
+                    case Opcode::constant_subtract:
+                        destination = scaled(left, -1) + instruction.constant;
+                        break;
+                    case Opcode::power:
+                        destination = left.pow(instruction.power);
+                        break;
+                }
+            }
+        }
+    };
+
+    /**
+     * @param expression Expression of the flux in u.
+     * Malformed expressions are reported, then exit.
+     */
+    explicit FluxExpression(std::string expression): _expression(std::move(expression)) {
+        _nodes.push_back({Kind::variable, 0, 0, 0, 0});
+        _flux = parse();
+        _derivative = differentiate(_flux);
+
+        _flux_program = compile({_flux});
+        _derivative_program = compile({_derivative});
+        _combined_program = compile({_flux, _derivative});
+        find_stationary_points();
+    }
+
+    const std::string &expression() const {
+        return _expression;
+    }
+    /**
+     * @return Program computing the flux.
+     */
+    const Program &flux_program() const {
+        return _flux_program;
+    }
+    /**
+     * @return Program computing the derivative of the flux.
+     */
+    const Program &derivative_program() const {
+        return _derivative_program;
+    }
+    /**
+     * @return Program computing the flux, then its derivative, sharing their common subexpressions.
+     */
+    const Program &combined_program() const {
+        return _combined_program;
+    }
+
+    /**
+     * @return Every real zero of the derivative, in increasing order.
+     * Exits if the derivative was too complex to solve for.
+     */
+    const std::vector<double> &stationary_points() const {
+        if (!_stationary_points_found) {
+            std::cerr << "Could not find the stationary points of the flux \"" << _expression << "\"!" << std::endl;
+            exit(EXIT_FAILURE);
+        }
+        return _stationary_points;
+    }
+
+private:
+    /*
+     * Expression graph. Each node only refers to earlier nodes, so nodes are in topological order.
+     */
+    enum class Kind : uint8_t {
+        variable,
+        constant,
+        add,
+        subtract,
+        multiply,
+        divide,
+        power,
+    };
+
+    struct Node {
+        Kind kind;
+        uint32_t left;
+        uint32_t right;
+        uint32_t power;
+        double value;
+    };
+
+    // Exponents are unrolled by the domains, so are kept small.
+    static constexpr uint32_t max_power = 64;
+    // Numerators of higher degree are not solved for stationary points.
+    static constexpr size_t max_degree = 64;
+    static constexpr uint32_t variable = 0;
+
+    std::string _expression;
+    size_t _position = 0;
+    std::vector<Node> _nodes;
+    std::map<std::tuple<Kind, uint32_t, uint32_t, uint32_t, double>, uint32_t> _unique_nodes;
+    uint32_t _flux;
+    uint32_t _derivative;
+    Program _flux_program;
+    Program _derivative_program;
+    Program _combined_program;
+    std::vector<double> _stationary_points;
+    bool _stationary_points_found = false;
+
+    /*
+     * Construction. Each operation folds constants and drops trivial operations before adding a node.
+     */
+
+    uint32_t intern(Kind kind, uint32_t left, uint32_t right, uint32_t power, double value) {
+        auto key = std::make_tuple(kind, left, right, power, value);
+        if (auto found = _unique_nodes.find(key); found != _unique_nodes.end()) {
+            return found->second;
+        }
+        _nodes.push_back({kind, left, right, power, value});
+        auto index = static_cast<uint32_t>(_nodes.size() - 1);
+        _unique_nodes.emplace(key, index);
+        return index;
+    }
+
+    bool is_constant(uint32_t node) const {
+        return _nodes[node].kind == Kind::constant;
+    }
+    bool is_constant(uint32_t node, double value) const {
+        return is_constant(node) && _nodes[node].value == value;
+    }
+    double value(uint32_t node) const {
+        return _nodes[node].value;
+    }
+
+    /**
+     * @return Whether a product of doubles is exact, so constants may be combined without changing the result.
+     */
+    static bool exact_product(double left, double right) {
+        auto product = left * right;
+        return std::isfinite(product) && std::fma(left, right, -product) == 0;
+    }
+
+    uint32_t constant(double value) {
+        // Fold negative zero into zero, so both share a node.
+        return intern(Kind::constant, 0, 0, 0, value == 0 ? 0.0 : value);
+    }
+
+    uint32_t add(uint32_t left, uint32_t right) {
+        if (is_constant(left) && is_constant(right)) {
+            return constant(value(left) + value(right));
+        }
+        // Commutative, so order operands uniquely, with constants on the right.
+        if (is_constant(left) || (!is_constant(right) && right < left)) {
+            std::swap(left, right);
+        }
+        if (is_constant(right, 0)) {
+            return left;
+        }
+        return intern(Kind::add, left, right, 0, 0);
+    }
+
+    uint32_t subtract(uint32_t left, uint32_t right) {
+        if (is_constant(left) && is_constant(right)) {
+            return constant(value(left) - value(right));
+        }
+        if (is_constant(right, 0)) {
+            return left;
+        }
+        if (is_constant(left, 0)) {
+            return multiply(right, constant(-1));
+        }
+        // Exactly zero, though intervals would not compute it as such.
+        if (left == right) {
+            return constant(0);
+        }
+        return intern(Kind::subtract, left, right, 0, 0);
+    }
+
+    uint32_t multiply(uint32_t left, uint32_t right) {
+        if (is_constant(left) && is_constant(right)) {
+            return constant(value(left) * value(right));
+        }
+        if (is_constant(left) || (!is_constant(right) && right < left)) {
+            std::swap(left, right);
+        }
+        if (is_constant(right, 0)) {
+            return constant(0);
+        }
+        if (is_constant(right, 1)) {
+            return left;
+        }
+        // Squares are tighter than products over intervals, as both factors vary together.
+        if (left == right) {
+            return power(left, 2);
+        }
+        // (x * a) * b = x * (a * b), if a * b is exact.
+        if (is_constant(right) && _nodes[left].kind == Kind::multiply && is_constant(_nodes[left].right)
+            && exact_product(value(_nodes[left].right), value(right))) {
+            return multiply(_nodes[left].left, constant(value(_nodes[left].right) * value(right)));
+        }
+        return intern(Kind::multiply, left, right, 0, 0);
+    }
+
+    uint32_t divide(uint32_t left, uint32_t right) {
+        if (is_constant(left) && is_constant(right)) {
+            return constant(value(left) / value(right));
+        }
+        if (is_constant(right, 1)) {
+            return left;
+        }
+        if (left == right) {
+            return constant(1);
+        }
+        // Dividing by a power of two is multiplying by its exact reciprocal, which folds into other constants.
+        if (is_constant(right)) {
+            int exponent;
+            if (std::frexp(value(right), &exponent) == 0.5 || std::frexp(value(right), &exponent) == -0.5) {
+                return multiply(left, constant(1 / value(right)));
+            }
+        }
+        return intern(Kind::divide, left, right, 0, 0);
+    }
+
+    uint32_t power(uint32_t base, uint32_t exponent) {
+        if (exponent == 0) {
+            return constant(1);
+        }
+        if (exponent == 1) {
+            return base;
+        }
+        if (is_constant(base)) {
+            return constant(std::pow(value(base), exponent));
+        }
+        if (_nodes[base].kind == Kind::power && _nodes[base].power * exponent <= max_power) {
+            return power(_nodes[base].left, _nodes[base].power * exponent);
+        }
+        return intern(Kind::power, base, 0, exponent, 0);
+    }
+
+    /*
+     * Parsing, by recursive descent:
+     * sum := product (('+' | '-') product)*
+     * product := unary (('*' | '/') unary)*
+     * unary := '-' unary | exponential
+     * exponential := primary ('^' unary)?
+     * primary := number | 'u' | '(' sum ')'
+     */
+
+    [[noreturn]] void fail(const std::string &reason) const {
+        std::cerr << "Invalid flux expression \"" << _expression << "\" at position " << _position << ": " << reason << std::endl;
+        exit(EXIT_FAILURE);
+    }
+
+    char peek() {
+        while (_position < _expression.size() && std::isspace(static_cast<unsigned char>(_expression[_position]))) {
+            _position++;
+        }
+        return _position < _expression.size() ? _expression[_position] : '\0';
+    }
+
+    uint32_t parse() {
+        auto root = parse_sum();
+        if (peek() != '\0') {
+            fail("unexpected character");
+        }
+        return root;
+    }
+
+    uint32_t parse_sum() {
+        auto left = parse_product();
+        for (auto next = peek(); next == '+' || next == '-'; next = peek()) {
+            _position++;
+            auto right = parse_product();
+            left = next == '+' ? add(left, right) : subtract(left, right);
+        }
+        return left;
+    }
+
+    uint32_t parse_product() {
+        auto left = parse_unary();
+        for (auto next = peek(); next == '*' || next == '/'; next = peek()) {
+            _position++;
+            auto right = parse_unary();
+            left = next == '*' ? multiply(left, right) : divide(left, right);
+        }
+        return left;
+    }
+
+    uint32_t parse_unary() {
+        if (peek() == '-') {
+            _position++;
+            return multiply(parse_unary(), constant(-1));
+        }
+        return parse_exponential();
+    }
+
+    uint32_t parse_exponential() {
+        auto base = parse_primary();
+        if (peek() != '^') {
+            return base;
+        }
+        _position++;
+        auto exponent = parse_unary();
+        if (!is_constant(exponent) || value(exponent) < 0 || value(exponent) > max_power
+            || value(exponent) != std::floor(value(exponent))) {
+            fail("exponents must be integers from 0 to " + std::to_string(max_power));
+        }
+        return power(base, static_cast<uint32_t>(value(exponent)));
+    }
+
+    uint32_t parse_primary() {
+        auto next = peek();
+        if (next == '(') {
+            _position++;
+            auto inner = parse_sum();
+            if (peek() != ')') {
+                fail("expected ')'");
+            }
+            _position++;
+            return inner;
+        }
+        if (next == 'u') {
+            _position++;
+            if (std::isalnum(static_cast<unsigned char>(peek())) || peek() == '_') {
+                fail("the only variable is u");
+            }
+            return variable;
+        }
+        if (std::isdigit(static_cast<unsigned char>(next)) || next == '.') {
+            char *end = nullptr;
+            auto start = _expression.c_str() + _position;
+            auto number = std::strtod(start, &end);
+            // strtod also reads hexadecimal, which expressions do not allow.
+            auto hexadecimal = std::any_of(start, static_cast<const char *>(end), [](char c) {
+                return c == 'x' || c == 'X' || c == 'p' || c == 'P';
+            });
+            if (hexadecimal) {
+                fail("numbers must be decimal");
+            }
+            if (!std::isfinite(number)) {
+                fail("numbers must be finite");
+            }
+            _position = end - _expression.c_str();
+            return constant(number);
+        }
+        fail(next == '\0' ? "unexpected end" : "expected a number, u, or '('");
+    }
+
+    /*
+     * Differentiation, with respect to u.
+     */
+
+    uint32_t differentiate(uint32_t root) {
+        // Memoized, so shared subexpressions are differentiated once.
+        auto derivatives = std::map<uint32_t, uint32_t>();
+        auto derive = [&](auto &self, uint32_t node) -> uint32_t {
+            if (auto found = derivatives.find(node); found != derivatives.end()) {
+                return found->second;
+            }
+            auto [kind, left, right, exponent, _] = _nodes[node];
+            uint32_t result;
+            switch (kind) {
+                case Kind::variable:
+                    result = constant(1);
+                    break;
+                case Kind::constant:
+                    result = constant(0);
+                    break;
+                case Kind::add:
+                    result = add(self(self, left), self(self, right));
+                    break;
+                case Kind::subtract:
+                    result = subtract(self(self, left), self(self, right));
+                    break;
+                case Kind::multiply:
+                    result = add(multiply(self(self, left), right), multiply(left, self(self, right)));
+                    break;
+                case Kind::divide:
+                    if (is_constant(right)) {
+                        result = divide(self(self, left), right);
+                    } else {
+                        result = divide(subtract(multiply(self(self, left), right), multiply(left, self(self, right))), power(right, 2));
+                    }
+                    break;
+                case Kind::power:
+                    result = multiply(multiply(power(left, exponent - 1), constant(exponent)), self(self, left));
+                    break;
+            }
+            derivatives.emplace(node, result);
+            return result;
+        };
+        return derive(derive, root);
+    }
+
+    /*
+     * Compilation
+     */
+
+    /**
+     * @return Operands of a node which are read from registers. Constant operands are folded into instructions,
+     * except the dividend of a constant divided by a value.
+     */
+    std::vector<uint32_t> register_operands(uint32_t node) const {
+        auto [kind, left, right, exponent, _] = _nodes[node];
+        switch (kind) {
+            case Kind::variable:
+            case Kind::constant:
+                return {};
+            case Kind::power:
+                return {left};
+            case Kind::divide:
+                if (is_constant(right)) {
+                    return {left};
+                }
+                return {left, right};
+            default:
+                if (is_constant(right)) {
+                    return {left};
+                }
+                if (is_constant(left)) {
+                    return {right};
+                }
+                return {left, right};
+        }
+    }
+
+    Instruction instruction(uint32_t node, const std::vector<uint16_t> &registers, uint16_t destination) const {
+        auto [kind, left, right, exponent, constant_value] = _nodes[node];
+        auto result = Instruction{Opcode::constant, destination, 0, 0, 0, 0};
+        auto binary = [&](Opcode op) {
+            result.op = op;
+            result.left = registers[left];
+            result.right = registers[right];
+        };
+        auto with_constant = [&](Opcode op, uint32_t operand, double constant) {
+            result.op = op;
+            result.left = registers[operand];
+            result.constant = constant;
+        };
+        switch (kind) {
+            case Kind::variable:
+                assert(false);
+                break;
+            case Kind::constant:
+                result.constant = constant_value;
+                break;
+            case Kind::add:
+                is_constant(right) ? with_constant(Opcode::add_constant, left, value(right)) : binary(Opcode::add);
+                break;
+            case Kind::multiply:
+                is_constant(right) ? with_constant(Opcode::multiply_constant, left, value(right)) : binary(Opcode::multiply);
+                break;
+            case Kind::subtract:
+                if (is_constant(right)) {
+                    with_constant(Opcode::subtract_constant, left, value(right));
+                } else if (is_constant(left)) {
+                    with_constant(Opcode::constant_subtract, right, value(left));
+                } else {
+                    binary(Opcode::subtract);
+                }
+                break;
+            case Kind::divide:
+                is_constant(right) ? with_constant(Opcode::divide_constant, left, value(right)) : binary(Opcode::divide);
+                break;
+            case Kind::power:
+                result.op = Opcode::power;
+                result.left = registers[left];
+                result.power = exponent;
+                break;
+        }
+        return result;
+    }
+
+    /**
+     * @brief Compile the nodes reachable from some outputs into a program.
+     * Nodes are already in topological order, so are emitted in order, each into the first free register.
+     * A register is freed after the last instruction reading it, unless it holds an output.
+     */
+    Program compile(const std::vector<uint32_t> &outputs) const {
+        auto reachable = std::vector<char>(_nodes.size(), 0);
+        auto pending = std::vector<uint32_t>(outputs);
+        while (!pending.empty()) {
+            auto node = pending.back();
+            pending.pop_back();
+            if (reachable[node]) {
+                continue;
+            }
+            reachable[node] = 1;
+            for (auto operand : register_operands(node)) {
+                pending.push_back(operand);
+            }
+        }
+
+        // Index of the last node reading each node, or past every node for outputs.
+        auto last_use = std::vector<size_t>(_nodes.size(), 0);
+        for (uint32_t node = 0; node < _nodes.size(); node++) {
+            if (reachable[node]) {
+                for (auto operand : register_operands(node)) {
+                    last_use[operand] = node;
+                }
+            }
+        }
+        for (auto output : outputs) {
+            last_use[output] = _nodes.size();
+        }
+
+        auto program = Program();
+        auto registers = std::vector<uint16_t>(_nodes.size(), 0);
+        auto free_registers = std::vector<uint16_t>();
+        auto release = [&](uint32_t node, uint32_t reader) {
+            if (last_use[node] == reader) {
+                free_registers.push_back(registers[node]);
+                // Only release each register once, even if read twice.
+                last_use[node] = 0;
+            }
+        };
+        for (uint32_t node = 1; node < _nodes.size(); node++) {
+            if (!reachable[node]) {
+                continue;
+            }
+            auto operands = register_operands(node);
+            auto destination = program.num_registers;
+            for (auto operand : operands) {
+                release(operand, node);
+            }
+            if (!free_registers.empty()) {
+                // Prefer the lowest register, so the register file stays dense.
+                auto lowest = std::min_element(free_registers.begin(), free_registers.end());
+                destination = *lowest;
+                free_registers.erase(lowest);
+            } else {
+                program.num_registers++;
+            }
+            registers[node] = destination;
+            program.instructions.push_back(instruction(node, registers, destination));
+        }
+        for (auto output : outputs) {
+            program.outputs.push_back(registers[output]);
+        }
+        return program;
+    }
+
+    /*
+     * Stationary points. The derivative is a rational function of u, so its zeros are the real roots of its numerator.
+     */
+
+    // Coefficients, from the constant term up.
+    using Polynomial = std::vector<double>;
+
+    struct Rational {
+        Polynomial numerator;
+        Polynomial denominator;
+    };
+
+    static void trim(Polynomial &p) {
+        while (p.size() > 1 && p.back() == 0) {
+            p.pop_back();
+        }
+    }
+    static Polynomial plus(const Polynomial &left, const Polynomial &right, double sign) {
+        auto sum = Polynomial(std::max(left.size(), right.size()), 0);
+        for (size_t i = 0; i < left.size(); i++) {
+            sum[i] += left[i];
+        }
+        for (size_t i = 0; i < right.size(); i++) {
+            sum[i] += sign * right[i];
+        }
+        trim(sum);
+        return sum;
+    }
+    static Polynomial times(const Polynomial &left, const Polynomial &right) {
+        auto product = Polynomial(left.size() + right.size() - 1, 0);
+        for (size_t i = 0; i < left.size(); i++) {
+            for (size_t j = 0; j < right.size(); j++) {
+                product[i + j] += left[i] * right[j];
+            }
+        }
+        trim(product);
+        return product;
+    }
+    static double evaluate(const Polynomial &p, double x) {
+        auto result = 0.0;
+        for (auto coefficient = p.rbegin(); coefficient != p.rend(); coefficient++) {
+            result = result * x + *coefficient;
+        }
+        return result;
+    }
+    /**
+     * @return Whether a polynomial vanishes at x, up to rounding in its evaluation.
+     */
+    static bool vanishes(const Polynomial &p, double x) {
+        auto scale = 0.0;
+        for (auto coefficient = p.rbegin(); coefficient != p.rend(); coefficient++) {
+            scale = scale * std::abs(x) + std::abs(*coefficient);
+        }
+        return std::abs(evaluate(p, x)) <= 1e-9 * scale;
+    }
+
+    /**
+     * @return The real roots of a polynomial, in increasing order.
+     * Roots of the derivative split the line into intervals on which the polynomial is monotone,
+     * so each interval holds at most one root, found by bisection. Multiple roots are the derivative's roots.
+     */
+    static std::vector<double> real_roots(Polynomial p) {
+        trim(p);
+        auto degree = p.size() - 1;
+        if (degree == 0) {
+            return {};
+        }
+        if (degree == 1) {
+            return {-p[0] / p[1]};
+        }
+
+        auto derivative = Polynomial(degree);
+        for (size_t i = 1; i <= degree; i++) {
+            derivative[i - 1] = p[i] * static_cast<double>(i);
+        }
+        // Every root is within Cauchy's bound.
+        auto bound = 0.0;
+        for (size_t i = 0; i < degree; i++) {
+            bound = std::max(bound, std::abs(p[i] / p[degree]));
+        }
+        bound += 1;
+
+        auto points = std::vector<double>{-bound};
+        for (auto critical : real_roots(derivative)) {
+            points.push_back(std::clamp(critical, -bound, bound));
+        }
+        points.push_back(bound);
+
+        auto roots = std::vector<double>();
+        for (size_t i = 0; i + 1 < points.size(); i++) {
+            if (i > 0 && vanishes(p, points[i])) {
+                roots.push_back(points[i]);
+                continue;
+            }
+            auto low = points[i];
+            auto high = points[i + 1];
+            if ((evaluate(p, low) < 0) == (evaluate(p, high) < 0) || vanishes(p, high)) {
+                continue;
+            }
+            auto rising = evaluate(p, low) < 0;
+            for (auto middle = (low + high) / 2; middle > low && middle < high; middle = (low + high) / 2) {
+                ((evaluate(p, middle) < 0) == rising ? low : high) = middle;
+            }
+            roots.push_back(low);
+        }
+        return roots;
+    }
+
+    void find_stationary_points() {
+        auto rationals = std::vector<Rational>(_nodes.size());
+        for (uint32_t node = 0; node <= _derivative; node++) {
+            auto [kind, left, right, exponent, constant_value] = _nodes[node];
+            const auto &l = rationals[left];
+            const auto &r = rationals[right];
+            auto &result = rationals[node];
+            switch (kind) {
+                case Kind::variable:
+                    result = {{0, 1}, {1}};
+                    break;
+                case Kind::constant:
+                    result = {{constant_value}, {1}};
+                    break;
+                case Kind::add:
+                case Kind::subtract: {
+                    auto sign = kind == Kind::add ? 1.0 : -1.0;
+                    if (l.denominator == r.denominator) {
+                        result = {plus(l.numerator, r.numerator, sign), l.denominator};
+                    } else {
+                        result = {plus(times(l.numerator, r.denominator), times(r.numerator, l.denominator), sign),
+                            times(l.denominator, r.denominator)};
+                    }
+                    break;
+                }
+                case Kind::multiply:
+                    result = {times(l.numerator, r.numerator), times(l.denominator, r.denominator)};
+                    break;
+                case Kind::divide:
+                    result = {times(l.numerator, r.denominator), times(l.denominator, r.numerator)};
+                    break;
+                case Kind::power:
+                    result = {{1}, {1}};
+                    for (uint32_t i = 0; i < exponent; i++) {
+                        result = {times(result.numerator, l.numerator), times(result.denominator, l.denominator)};
+                    }
+                    break;
+            }
+            if (result.numerator.size() > max_degree + 1 || result.denominator.size() > max_degree + 1) {
+                return;
+            }
+        }
+
+        // Zeros of the denominator are poles of the flux, not stationary points.
+        const auto &derivative = rationals[_derivative];
+        for (auto root : real_roots(derivative.numerator)) {
+            if (!vanishes(derivative.denominator, root)) {
+                _stationary_points.push_back(root);
+            }
+        }
+        std::sort(_stationary_points.begin(), _stationary_points.end());
+        _stationary_points.erase(std::unique(_stationary_points.begin(), _stationary_points.end()), _stationary_points.end());
+        _stationary_points_found = true;
+    }
+};
+
+/**
+ * Flux function given by an expression in u, set at runtime, so new fluxes need no rebuild.
+ * See FluxExpression for the syntax.
+ *
+ * @tparam T Numeric type flux function operates over.
+ */
+template<typename T>
+requires Numeric<T>
+class ExpressionFlux final : public FluxFunction<T> {
+public:
+    static constexpr auto name = "expression";
+
+    /**
+     * @param expression Expression of the flux in u, i.e. "u^2 / 2" for Burgers.
+     */
+    explicit ExpressionFlux(const std::string &expression): _expression(std::make_shared<const FluxExpression>(expression)) {}
+
+    T flux(const T &value) override {
+        const auto &program = _expression->flux_program();
+        return run(program, value)[program.outputs[0]];
+    }
+    T derivative_flux(const T &value) override {
+        const auto &program = _expression->derivative_program();
+        return run(program, value)[program.outputs[0]];
+    }
+    FluxEvaluation<T> flux_with_derivative(const T &value) override {
+        const auto &program = _expression->combined_program();
+        auto registers = run(program, value);
+        return {registers[program.outputs[0]], registers[program.outputs[1]]};
+    }
+    std::vector<double> stationary_points() const override {
+        return _expression->stationary_points();
+    }
+
+    const FluxExpression &expression() const {
+        return *_expression;
+    }
+
+private:
+    // Parsed once, and shared by copies.
+    std::shared_ptr<const FluxExpression> _expression;
+
+    /**
+     * @return Registers of the program, after running it.
+     * Registers are reused between calls on each thread, so the next call on the thread overwrites them.
+     */
+    static const T *run(const FluxExpression::Program &program, const T &value) {
+        static thread_local std::vector<T> registers;
+        if (registers.size() < program.num_registers) {
+            registers.resize(program.num_registers);
+        }
+        program.execute(value, registers.data());
+        return registers.data();
+    }
+};
+
+#endif //PDENCLOSE_EXPRESSIONFLUX_H
@@ -5,8 +5,21 @@
 #ifndef PDENCLOSE_FLUXFUNCTION_H
 #define PDENCLOSE_FLUXFUNCTION_H
 
+#include <concepts>
+#include <vector>
+
 #include "domains/Numeric.hpp"
 
+/**
+ * A flux function and its derivative, evaluated at the same value.
+ */
+template<typename T>
+requires Numeric<T>
+struct FluxEvaluation {
+    T flux;
+    T derivative;
+};
+
 template<typename T>
 requires Numeric<T>
 class FluxFunction {
@@ -14,8 +27,30 @@ public:
     FluxFunction() = default;
     virtual ~FluxFunction() = default;
 
-    virtual T flux(T value) = 0;
-    virtual T derivative_flux(T value) = 0;
+    virtual T flux(const T &value) = 0;
+    virtual T derivative_flux(const T &value) = 0;
+
+    /**
+     * @brief Evaluate the flux and its derivative at once, sharing intermediate terms between them.
+     * For affine and mixed domains, every shared term is one fewer operation introducing new noise symbols.
+     * By default, evaluates each separately.
+     */
+    virtual FluxEvaluation<T> flux_with_derivative(const T &value) {
+        return {flux(value), derivative_flux(value)};
+    }
+
+    /**
+     * @return Every real value at which the derivative of the flux is zero, in increasing order.
+     * The flux is monotone between consecutive points, so its extrema over any range lie at these or at the range's ends.
+     */
+    virtual std::vector<double> stationary_points() const = 0;
 };
 
+/**
+ * A flux function over T, either the FluxFunction interface itself or a concrete implementation.
+ * Solvers parameterized by a concrete (final) flux have their flux calls resolved statically.
+ */
+template<typename F, typename T>
+concept Flux = std::derived_from<F, FluxFunction<T>>;
+
 #endif //PDENCLOSE_FLUXFUNCTION_H
\ No newline at end of file
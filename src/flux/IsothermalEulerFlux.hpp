@@ -0,0 +1,49 @@
+//
+// Created by will on 12/10/25.
+//
+
+#ifndef PDENCLOSE_ISOTHERMALEULERFLUX_H
+#define PDENCLOSE_ISOTHERMALEULERFLUX_H
+#include <cassert>
+
+#include "SystemFluxFunction.hpp"
+#include "domains/LinearCombination.hpp"
+#include "domains/Numeric.hpp"
+
+/**
+ * Isothermal Euler equations of gas dynamics, with pressure a^2 * density for a constant sound speed a.
+ * State is (density, momentum), with flux (momentum, momentum^2 / density + a^2 * density).
+ * Wave speeds are velocity -+ a, so the spectral radius is |velocity| + a.
+ *
+ * Density must stay positive, i.e. enclosures of it must not contain zero.
+ */
+template<typename T>
+requires Numeric<T>
+class IsothermalEulerFlux final : public SystemFluxFunction<T, 2> {
+public:
+    static constexpr auto name = "isothermal_euler";
+
+    /**
+     * @param sound_speed Speed of sound a, > 0.
+     */
+    explicit IsothermalEulerFlux(double sound_speed = 1): _sound_speed(sound_speed) {
+        assert(sound_speed > 0);
+    }
+
+    SystemState<T, 2> flux(const SystemState<T, 2> &state) override {
+        return flux_with_spectral_radius(state).flux;
+    }
+    T spectral_radius(const SystemState<T, 2> &state) override {
+        return flux_with_spectral_radius(state).spectral_radius;
+    }
+    SystemFluxEvaluation<T, 2> flux_with_spectral_radius(const SystemState<T, 2> &state) override {
+        const auto &[density, momentum] = state;
+        auto velocity = momentum / density;
+        return {{momentum, scaled(density, _sound_speed * _sound_speed) + momentum * velocity}, velocity.abs() + _sound_speed};
+    }
+
+private:
+    double _sound_speed;
+};
+
+#endif //PDENCLOSE_ISOTHERMALEULERFLUX_H
@@ -5,6 +5,7 @@
 #ifndef PDENCLOSE_LWRFLUX_H
 #define PDENCLOSE_LWRFLUX_H
 #include "FluxFunction.hpp"
+#include "domains/LinearCombination.hpp"
 #include "domains/Numeric.hpp"
 
 /**
@@ -16,11 +17,20 @@ template<typename T>
 requires Numeric<T>
 class LwrFlux final : public FluxFunction<T> {
 public:
-    T flux(T value) override {
-        return value * (value * -1 + 1);
+    static constexpr auto name = "lwr";
+
+    T flux(const T &value) override {
+        return value * (scaled(value, -1) + 1);
+    }
+    T derivative_flux(const T &value) override {
+        return scaled(value, -2) + 1;
+    }
+    FluxEvaluation<T> flux_with_derivative(const T &value) override {
+        T complement = scaled(value, -1) + 1;
+        return {value * complement, complement - value};
     }
-    T derivative_flux(T value) override {
-        return value * -2 + 1;
+    std::vector<double> stationary_points() const override {
+        return {0.5};
     }
 };
 
@@ -0,0 +1,59 @@
+//
+// Created by will on 12/10/25.
+//
+
+#ifndef PDENCLOSE_SHALLOWWATERFLUX_H
+#define PDENCLOSE_SHALLOWWATERFLUX_H
+#include <cassert>
+#include <cmath>
+
+#include "SystemFluxFunction.hpp"
+#include "domains/LinearCombination.hpp"
+#include "domains/Numeric.hpp"
+
+/**
+ * Shallow water equations over a flat bed.
+ * State is (height, discharge = height * velocity), with flux (discharge, discharge^2 / height + g * height^2 / 2).
+ * Wave speeds are velocity -+ sqrt(g * height).
+ *
+ * Numeric domains have no square root, so the celerity sqrt(g * h) is bounded by its tangent at a reference height h0:
+ * sqrt(g * h) <= (g * h / c + c) / 2, with c = sqrt(g * h0). The bound is exact at h0, and grows slowly near it,
+ * so pick h0 near the typical height of the flow.
+ *
+ * Height must stay positive, i.e. enclosures of it must not contain zero.
+ */
+template<typename T>
+requires Numeric<T>
+class ShallowWaterFlux final : public SystemFluxFunction<T, 2> {
+public:
+    static constexpr auto name = "shallow_water";
+
+    /**
+     * @param gravity Gravitational acceleration g, > 0.
+     * @param reference_height Height h0 the celerity bound is exact at, > 0.
+     */
+    explicit ShallowWaterFlux(double gravity = 9.81, double reference_height = 1):
+        _gravity(gravity), _reference_celerity(std::sqrt(gravity * reference_height)) {
+        assert(gravity > 0 && reference_height > 0);
+    }
+
+    SystemState<T, 2> flux(const SystemState<T, 2> &state) override {
+        return flux_with_spectral_radius(state).flux;
+    }
+    T spectral_radius(const SystemState<T, 2> &state) override {
+        return flux_with_spectral_radius(state).spectral_radius;
+    }
+    SystemFluxEvaluation<T, 2> flux_with_spectral_radius(const SystemState<T, 2> &state) override {
+        const auto &[height, discharge] = state;
+        auto velocity = discharge / height;
+        // Halved after the sum, as distributing the half would round differently.
+        auto celerity = T(scaled(height, _gravity / _reference_celerity) + _reference_celerity) * 0.5;
+        return {{discharge, scaled(height.pow(2), _gravity * 0.5) + discharge * velocity}, velocity.abs() + celerity};
+    }
+
+private:
+    double _gravity;
+    double _reference_celerity;
+};
+
+#endif //PDENCLOSE_SHALLOWWATERFLUX_H
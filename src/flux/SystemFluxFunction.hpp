@@ -0,0 +1,64 @@
+//
+// Created by will on 12/10/25.
+//
+
+#ifndef PDENCLOSE_SYSTEMFLUXFUNCTION_H
+#define PDENCLOSE_SYSTEMFLUXFUNCTION_H
+#include <array>
+#include <concepts>
+#include <cstddef>
+
+#include "domains/Numeric.hpp"
+
+/**
+ * State of one cell of a system of conservation laws, one value per conserved quantity.
+ */
+template<typename T, size_t M>
+using SystemState = std::array<T, M>;
+
+/**
+ * Flux of a system at one state, with the spectral radius of its Jacobian there -- the fastest wave speed.
+ * Schemes need both at every cell, and they usually share intermediate values, i.e. velocity.
+ */
+template<typename T, size_t M>
+struct SystemFluxEvaluation {
+    SystemState<T, M> flux;
+    T spectral_radius;
+};
+
+/**
+ * Flux function of a system of M conservation laws, u_t + f(u)_x = 0 for u with M components.
+ * Unlike scalar fluxes, the Jacobian of f is a matrix, so schemes only ask for its spectral radius, which bounds
+ * how fast information moves, and so sets both the numerical viscosity and the CFL condition.
+ *
+ * @tparam T Numeric type of each component.
+ * @tparam M Number of conserved quantities.
+ */
+template<typename T, size_t M>
+requires Numeric<T>
+class SystemFluxFunction {
+public:
+    static constexpr size_t components = M;
+
+    SystemFluxFunction() = default;
+    virtual ~SystemFluxFunction() = default;
+
+    virtual SystemState<T, M> flux(const SystemState<T, M> &state) = 0;
+    /**
+     * @return The largest absolute eigenvalue of the Jacobian of the flux at a state, or an upper bound on it.
+     */
+    virtual T spectral_radius(const SystemState<T, M> &state) = 0;
+
+    /**
+     * @brief Evaluate the flux and spectral radius together.
+     * Schemes need both at every cell, so fluxes should override this to share work between them.
+     */
+    virtual SystemFluxEvaluation<T, M> flux_with_spectral_radius(const SystemState<T, M> &state) {
+        return {flux(state), spectral_radius(state)};
+    }
+};
+
+template<typename F, typename T, size_t M>
+concept SystemFlux = std::derived_from<F, SystemFluxFunction<T, M>>;
+
+#endif //PDENCLOSE_SYSTEMFLUXFUNCTION_H
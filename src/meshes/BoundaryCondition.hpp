@@ -0,0 +1,114 @@
+//
+// Created by will on 12/4/25.
+//
+
+#ifndef PDENCLOSE_BOUNDARYCONDITION_H
+#define PDENCLOSE_BOUNDARYCONDITION_H
+#include <cassert>
+#include <cstdint>
+#include <utility>
+
+#include "domains/Numeric.hpp"
+
+/**
+ * Boundary condition for a 1d system, applied by filling the ghost cells on either side of a mesh row.
+ * Once the ghost cells of a row are filled, stencils may read past either edge of the row without special cases.
+ *
+ * @tparam T Numeric type of the mesh.
+ */
+template<typename T>
+requires Numeric<T>
+class BoundaryCondition {
+public:
+    virtual ~BoundaryCondition() = default;
+
+    /**
+     * @param row Pointer to the first interior cell of a row.
+     * Ghost cells are at row[-ghost_cells, -1] and row[size, size + ghost_cells - 1].
+     * @param size Number of interior cells in the row.
+     * @param ghost_cells Number of ghost cells on each side of the row.
+     */
+    virtual void fill(T *row, uint64_t size, uint32_t ghost_cells) const = 0;
+};
+
+/**
+ * The system wraps around: the left neighbor of the first cell is the last cell.
+ */
+template<typename T>
+requires Numeric<T>
+class PeriodicBoundary final : public BoundaryCondition<T> {
+public:
+    static constexpr auto name = "periodic";
+
+    void fill(T *row, uint64_t size, uint32_t ghost_cells) const override {
+        assert(size >= ghost_cells);
+        for (int64_t k = 1; k <= ghost_cells; k++) {
+            row[-k] = row[size - k];
+            row[size - 1 + k] = row[k - 1];
+        }
+    }
+};
+
+/**
+ * Zero-gradient boundary: waves leave the system without reflecting.
+ */
+template<typename T>
+requires Numeric<T>
+class OutflowBoundary final : public BoundaryCondition<T> {
+public:
+    static constexpr auto name = "outflow";
+
+    void fill(T *row, uint64_t size, uint32_t ghost_cells) const override {
+        for (int64_t k = 1; k <= ghost_cells; k++) {
+            row[-k] = row[0];
+            row[size - 1 + k] = row[size - 1];
+        }
+    }
+};
+
+/**
+ * Solid walls: the system is mirrored across each edge.
+ */
+template<typename T>
+requires Numeric<T>
+class ReflectiveBoundary final : public BoundaryCondition<T> {
+public:
+    static constexpr auto name = "reflective";
+
+    void fill(T *row, uint64_t size, uint32_t ghost_cells) const override {
+        assert(size >= ghost_cells);
+        for (int64_t k = 1; k <= ghost_cells; k++) {
+            row[-k] = row[k - 1];
+            row[size - 1 + k] = row[size - k];
+        }
+    }
+};
+
+/**
+ * Fixed values held outside each edge of the system.
+ */
+template<typename T>
+requires Numeric<T>
+class DirichletBoundary final : public BoundaryCondition<T> {
+public:
+    static constexpr auto name = "dirichlet";
+
+    /**
+     * @param left Value held to the left of the system.
+     * @param right Value held to the right of the system.
+     */
+    DirichletBoundary(T left, T right): _left(std::move(left)), _right(std::move(right)) {}
+
+    void fill(T *row, uint64_t size, uint32_t ghost_cells) const override {
+        for (int64_t k = 1; k <= ghost_cells; k++) {
+            row[-k] = _left;
+            row[size - 1 + k] = _right;
+        }
+    }
+
+private:
+    T _left;
+    T _right;
+};
+
+#endif //PDENCLOSE_BOUNDARYCONDITION_H
@@ -14,11 +14,20 @@
  */
 const uint32_t c_max = 1;
 
+/**
+ * @param derivative Derivative of the flux at a mesh point, i.e. as already evaluated by a solver.
+ */
 template<typename T>
 requires Numeric<T>
-bool cfl_check(FluxFunction<T> *f, T mesh_point, double delta_t, double delta_x) {
-    auto cfl_value = f->derivative_flux(mesh_point).abs() * delta_t / delta_x;
+bool cfl_check_derivative(const T &derivative, double delta_t, double delta_x) {
+    auto cfl_value = derivative.abs() * delta_t / delta_x;
     return cfl_value < c_max;
 }
 
+template<typename T, typename F>
+requires Numeric<T> && Flux<F, T>
+bool cfl_check(F *f, const T &mesh_point, double delta_t, double delta_x) {
+    return cfl_check_derivative(f->derivative_flux(mesh_point), delta_t, delta_x);
+}
+
 #endif //PDENCLOSE_CFL_CHECK_H
\ No newline at end of file
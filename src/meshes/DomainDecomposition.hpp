@@ -0,0 +1,279 @@
+//
+// Created by will on 12/10/25.
+//
+
+#ifndef PDENCLOSE_DOMAINDECOMPOSITION_H
+#define PDENCLOSE_DOMAINDECOMPOSITION_H
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <optional>
+
+#ifdef PDENCLOSE_MPI
+#include <climits>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <mpi.h>
+
+#include "cereal/archives/binary.hpp"
+#include "cereal/types/vector.hpp"
+#include "BoundaryCondition.hpp"
+#include "RectangularMesh.hpp"
+#include "domains/Numeric.hpp"
+#endif
+
+/**
+ * Split of a 1d grid between ranks, each owning a contiguous span of cells.
+ * Spans are in rank order, and differ in size by at most one cell.
+ */
+class DomainDecomposition {
+public:
+    /**
+     * @param discretization_size Number of cells in the whole grid, >= ranks.
+     * @param rank Rank owning the span, < ranks.
+     * @param ranks Number of ranks splitting the grid, > 0.
+     */
+    DomainDecomposition(uint64_t discretization_size, uint32_t rank, uint32_t ranks):
+        _discretization_size(discretization_size), _rank(rank), _ranks(ranks) {
+        assert(ranks > 0 && rank < ranks);
+        assert(discretization_size >= ranks);
+    }
+
+    uint64_t discretization_size() const {
+        return _discretization_size;
+    }
+    uint32_t rank() const {
+        return _rank;
+    }
+    uint32_t ranks() const {
+        return _ranks;
+    }
+
+    /**
+     * @return Index of the first cell owned by a rank. The first discretization_size % ranks ranks own an extra cell.
+     */
+    uint64_t begin(uint32_t rank) const {
+        assert(rank <= _ranks);
+        auto base = _discretization_size / _ranks;
+        return rank * base + std::min<uint64_t>(rank, _discretization_size % _ranks);
+    }
+    uint64_t begin() const {
+        return begin(_rank);
+    }
+    /**
+     * @return Index past the last cell owned by this rank.
+     */
+    uint64_t end() const {
+        return begin(_rank + 1);
+    }
+    uint64_t size() const {
+        return end() - begin();
+    }
+
+    /**
+     * @param periodic Whether the grid wraps around, so the first and last ranks neighbor each other.
+     * @return Rank owning the cells left of this rank's span, if any.
+     */
+    std::optional<uint32_t> left_neighbor(bool periodic) const {
+        if (_rank > 0) {
+            return _rank - 1;
+        }
+        return periodic ? std::optional<uint32_t>(_ranks - 1) : std::nullopt;
+    }
+    /**
+     * @return Rank owning the cells right of this rank's span, if any.
+     */
+    std::optional<uint32_t> right_neighbor(bool periodic) const {
+        if (_rank < _ranks - 1) {
+            return _rank + 1;
+        }
+        return periodic ? std::optional<uint32_t>(0) : std::nullopt;
+    }
+
+#   ifdef PDENCLOSE_MPI
+    /**
+     * @return Split of a grid between every rank of MPI_COMM_WORLD, from the perspective of this process.
+     */
+    static DomainDecomposition world(uint64_t discretization_size) {
+        int rank = 0;
+        int ranks = 1;
+        MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+        MPI_Comm_size(MPI_COMM_WORLD, &ranks);
+        return {discretization_size, static_cast<uint32_t>(rank), static_cast<uint32_t>(ranks)};
+    }
+#   endif
+
+private:
+    uint64_t _discretization_size;
+    uint32_t _rank;
+    uint32_t _ranks;
+};
+
+#ifdef PDENCLOSE_MPI
+/**
+ * @brief Abort every rank after reporting an error.
+ * Exiting one rank alone would leave the others waiting in collectives.
+ */
+[[noreturn]] inline void abort_ranks() {
+    MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+    exit(EXIT_FAILURE);
+}
+
+/**
+ * Boundary of one rank's span of a distributed grid.
+ * Ghost cells facing another rank are received from it, while ghost cells at the edges of the whole grid are filled
+ * by the grid's own boundary condition. Under periodic boundaries, the first and last ranks exchange with each other.
+ *
+ * Every rank must fill its ghost cells the same number of times, in the same order, as each fill is a collective step.
+ * So, schemes whose steps depend on local data, like local time stepping or adaptive refinement, cannot be distributed.
+ *
+ * Halos are serialized as in checkpoints, so any domain may be sent.
+ * They are exchanged by blocking sendrecv: halos hold at most a stencil radius of cells, so latency dominates.
+ */
+template<typename T>
+requires Numeric<T>
+class HaloBoundary final : public BoundaryCondition<T> {
+public:
+    /**
+     * @param boundary Boundary condition of the whole grid.
+     * @param decomposition Span of the grid owned by this rank.
+     */
+    HaloBoundary(std::shared_ptr<BoundaryCondition<T>> boundary, const DomainDecomposition &decomposition):
+        _boundary(std::move(boundary)) {
+        assert(_boundary);
+        auto periodic = dynamic_cast<const PeriodicBoundary<T> *>(_boundary.get()) != nullptr;
+        auto left = decomposition.left_neighbor(periodic);
+        auto right = decomposition.right_neighbor(periodic);
+        _left = left ? static_cast<int>(*left) : MPI_PROC_NULL;
+        _right = right ? static_cast<int>(*right) : MPI_PROC_NULL;
+    }
+
+    void fill(T *row, uint64_t size, uint32_t ghost_cells) const override {
+        assert(size >= ghost_cells);
+        if (_left == MPI_PROC_NULL || _right == MPI_PROC_NULL) {
+            _boundary->fill(row, size, ghost_cells);
+        }
+        // Send the first cells left while receiving the right ghosts, then the last cells right while receiving the left ghosts.
+        exchange(row, row + size, ghost_cells, _left, _right);
+        exchange(row + size - ghost_cells, row - ghost_cells, ghost_cells, _right, _left);
+    }
+
+private:
+    std::shared_ptr<BoundaryCondition<T>> _boundary;
+    int _left;
+    int _right;
+
+    static void exchange(const T *cells, T *ghosts, uint32_t count, int destination, int source) {
+        std::string outgoing;
+        {
+            std::ostringstream ss;
+            // Inner scope needed to ensure proper flushing.
+            {
+                cereal::BinaryOutputArchive archive(ss);
+                archive(std::vector<T>(cells, cells + count));
+            }
+            outgoing = ss.str();
+        }
+
+        uint64_t outgoing_bytes = outgoing.size();
+        uint64_t incoming_bytes = 0;
+        MPI_Sendrecv(&outgoing_bytes, 1, MPI_UINT64_T, destination, 0, &incoming_bytes, 1, MPI_UINT64_T, source, 0,
+            MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+        auto incoming = std::string(incoming_bytes, '\0');
+        MPI_Sendrecv(outgoing.data(), static_cast<int>(outgoing_bytes), MPI_BYTE, destination, 1,
+            incoming.data(), static_cast<int>(incoming_bytes), MPI_BYTE, source, 1, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+        if (source == MPI_PROC_NULL) {
+            return;
+        }
+
+        auto halo = std::vector<T>();
+        {
+            std::istringstream ss(incoming);
+            cereal::BinaryInputArchive archive(ss);
+            archive(halo);
+        }
+        assert(halo.size() == count);
+        std::move(halo.begin(), halo.end(), ghosts);
+    }
+};
+
+/**
+ * @brief Write the rows of a distributed solution to one file, in the format of print_system.
+ * Each rank formats its own cells, then every rank writes its part of each row at once, through MPI-IO.
+ * Collective: every rank must call this.
+ *
+ * @param solution This rank's span of the solution.
+ * @param decomposition Span of the grid owned by this rank.
+ * @param path Path to write the solution to. Overwritten if present.
+ */
+template<typename T>
+requires Numeric<T>
+void write_distributed_system(const RectangularMesh<T> &solution, const DomainDecomposition &decomposition, const std::string &path) {
+    auto num_timesteps = solution.num_timesteps();
+    auto first = decomposition.rank() == 0;
+    auto last = decomposition.rank() == decomposition.ranks() - 1;
+
+    // This rank's part of each row, in order.
+    auto text = std::string();
+    auto lengths = std::vector<uint64_t>(num_timesteps);
+    for (uint64_t t = 0; t < num_timesteps; t++) {
+        std::ostringstream ss;
+        if (first) {
+            ss << "T" << t << ": ";
+        }
+        for (uint64_t x = 0; x < solution.discretization_size(); x++) {
+            ss << solution.get(t, x) << " ";
+        }
+        if (last) {
+            ss << "\n";
+        }
+        auto part = ss.str();
+        lengths[t] = part.size();
+        text += part;
+    }
+    if (text.size() > INT_MAX) {
+        std::cerr << "Rank " << decomposition.rank() << " has too much output to write at once!" << std::endl;
+        abort_ranks();
+    }
+
+    // Each part starts after the same row's parts from earlier ranks, and after every part of earlier rows.
+    auto preceding = std::vector<uint64_t>(num_timesteps, 0);
+    auto row_lengths = std::vector<uint64_t>(num_timesteps);
+    MPI_Exscan(lengths.data(), preceding.data(), static_cast<int>(num_timesteps), MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
+    if (first) {
+        // Exscan leaves the first rank's result undefined.
+        std::fill(preceding.begin(), preceding.end(), 0);
+    }
+    MPI_Allreduce(lengths.data(), row_lengths.data(), static_cast<int>(num_timesteps), MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
+
+    auto block_lengths = std::vector<int>(num_timesteps);
+    auto displacements = std::vector<MPI_Aint>(num_timesteps);
+    MPI_Aint row_start = 0;
+    for (uint64_t t = 0; t < num_timesteps; t++) {
+        block_lengths[t] = static_cast<int>(lengths[t]);
+        displacements[t] = row_start + static_cast<MPI_Aint>(preceding[t]);
+        row_start += static_cast<MPI_Aint>(row_lengths[t]);
+    }
+    MPI_Datatype parts;
+    MPI_Type_create_hindexed(static_cast<int>(num_timesteps), block_lengths.data(), displacements.data(), MPI_CHAR, &parts);
+    MPI_Type_commit(&parts);
+
+    MPI_File file;
+    if (MPI_File_open(MPI_COMM_WORLD, path.c_str(), MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &file) != MPI_SUCCESS) {
+        std::cerr << "Could not open " << path << " for writing!" << std::endl;
+        abort_ranks();
+    }
+    MPI_File_set_size(file, 0);
+    MPI_File_set_view(file, 0, MPI_CHAR, parts, "native", MPI_INFO_NULL);
+    MPI_File_write_all(file, text.data(), static_cast<int>(text.size()), MPI_CHAR, MPI_STATUS_IGNORE);
+    MPI_File_close(&file);
+    MPI_Type_free(&parts);
+}
+#endif
+
+#endif //PDENCLOSE_DOMAINDECOMPOSITION_H
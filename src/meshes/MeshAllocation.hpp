@@ -0,0 +1,136 @@
+//
+// Created by will on 12/8/25.
+//
+
+#ifndef PDENCLOSE_MESHALLOCATION_H
+#define PDENCLOSE_MESHALLOCATION_H
+#include <cassert>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <numeric>
+
+#include <sys/mman.h>
+
+/*
+ * Storage for the cells of a mesh.
+ *
+ * Cells are constructed in place rather than assigned into zeroed memory, so types owning resources
+ * (i.e. the noise symbols of an affine form) are always valid objects.
+ *
+ * Rows start on cache line boundaries, so no two threads writing different rows share a line.
+ * Construction is the first write to each page, and the OS places a page on the memory node of the thread that first
+ * touches it. So, cells are constructed in parallel with the same static schedule the solvers sweep rows with:
+ * each thread then works on memory local to its own node.
+ *
+ * Large meshes are backed by transparent huge pages, unless built with PDENCLOSE_HUGE_PAGES off.
+ */
+
+/**
+ * Size of a cache line, in bytes.
+ */
+constexpr uint64_t cache_line_size = 64;
+
+/**
+ * Size of a transparent huge page, in bytes. Allocations at least this large are aligned to it.
+ */
+constexpr uint64_t huge_page_size = 2 * 1024 * 1024;
+
+/**
+ * @param cells Number of cells in a row, including its ghost cells.
+ * @return The least number of cells, at least cells, spanning a whole number of cache lines.
+ */
+template<typename T>
+uint64_t aligned_row_stride(uint64_t cells) {
+    // Smallest number of cells spanning a whole number of lines.
+    auto granularity = cache_line_size / std::gcd(cache_line_size, sizeof(T));
+    return (cells + granularity - 1) / granularity * granularity;
+}
+
+/**
+ * @param timestep Row of the cell.
+ * @param index Index of the cell within its row. Negative indices address the left ghost cells.
+ * @param row_stride Number of cells between the starts of consecutive rows.
+ * @param ghost_cells Number of ghost cells padding the left of each row.
+ * @return Position of the cell in the storage of a mesh. Computed in 64 bits, so meshes may exceed 2^32 cells.
+ */
+inline uint64_t cell_offset(uint64_t timestep, int64_t index, uint64_t row_stride, uint32_t ghost_cells) {
+    return timestep * row_stride + ghost_cells + index;
+}
+
+/**
+ * @brief Allocate and construct the cells of a mesh, first touching each row from the threads which will sweep it.
+ *
+ * @param num_rows Number of rows.
+ * @param row_stride Number of cells between the starts of consecutive rows, from aligned_row_stride.
+ * @param row_begin Index of the first cell of each row.
+ * @param row_end Index past the last cell of each row. Cells past it are padding, and are never constructed.
+ * @param sweep_begin Index of the first cell swept by solvers in each row.
+ * @param sweep_end Index past the last cell swept by solvers in each row.
+ * @return Pointer to the first cell of the first row, aligned to a cache line.
+ */
+template<typename T>
+T *allocate_cells(uint64_t num_rows, uint64_t row_stride, uint64_t row_begin, uint64_t row_end,
+    uint64_t sweep_begin, uint64_t sweep_end) {
+    assert(row_begin <= sweep_begin && sweep_begin <= sweep_end && sweep_end <= row_end && row_end <= row_stride);
+
+    auto bytes = num_rows * row_stride * sizeof(T);
+    auto alignment = cache_line_size;
+#   ifdef PDENCLOSE_HUGE_PAGES
+    if (bytes >= huge_page_size) {
+        alignment = huge_page_size;
+    }
+#   endif
+    // aligned_alloc requires a multiple of the alignment.
+    bytes = (bytes + alignment - 1) / alignment * alignment;
+    auto cells = static_cast<T *>(std::aligned_alloc(alignment, bytes));
+    assert(cells);
+
+#   ifdef PDENCLOSE_HUGE_PAGES
+    // Only advice: if huge pages are unavailable, the mesh is backed by ordinary pages.
+    if (alignment == huge_page_size) {
+        madvise(cells, bytes, MADV_HUGEPAGE);
+    }
+#   endif
+
+    // Matches the static schedule solvers sweep each row with, so each thread constructs the cells it will write.
+#   pragma omp parallel default(none) shared(cells, num_rows, row_stride, sweep_begin, sweep_end)
+    for (uint64_t t = 0; t < num_rows; t++) {
+        auto row = cells + t * row_stride;
+#       pragma omp for schedule(static) nowait
+        for (auto x = sweep_begin; x < sweep_end; x++) {
+            new (row + x) T();
+        }
+    }
+
+    // Cells outside of the sweep are only ghost cells, so are too few to be worth splitting between threads.
+    for (uint64_t t = 0; t < num_rows; t++) {
+        auto row = cells + t * row_stride;
+        for (auto x = row_begin; x < sweep_begin; x++) {
+            new (row + x) T();
+        }
+        for (auto x = sweep_end; x < row_end; x++) {
+            new (row + x) T();
+        }
+    }
+    return cells;
+}
+
+/**
+ * @brief Destroy and free cells allocated by allocate_cells, with the same layout.
+ */
+template<typename T>
+void free_cells(T *cells, uint64_t num_rows, uint64_t row_stride, uint64_t row_begin, uint64_t row_end) {
+    if (!cells) {
+        return;
+    }
+#   pragma omp parallel for default(none) shared(cells, num_rows, row_stride, row_begin, row_end)
+    for (uint64_t t = 0; t < num_rows; t++) {
+        for (auto x = row_begin; x < row_end; x++) {
+            cells[t * row_stride + x].~T();
+        }
+    }
+    std::free(cells);
+}
+
+#endif //PDENCLOSE_MESHALLOCATION_H
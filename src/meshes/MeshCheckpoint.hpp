@@ -0,0 +1,211 @@
+//
+// Created by will on 12/2/25.
+//
+
+#ifndef PDENCLOSE_MESHCHECKPOINT_H
+#define PDENCLOSE_MESHCHECKPOINT_H
+#include <cassert>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "RectangularMesh.hpp"
+#include "domains/Numeric.hpp"
+#include "domains/NoiseSymbols.hpp"
+
+#include "cereal/archives/binary.hpp"
+#include "cereal/types/vector.hpp"
+
+/**
+ * Periodic on-disk snapshots of a solution mesh, so that long simulations survive interruption.
+ *
+ * A checkpoint is split between two binary files:
+ * - <path>.rows is an append-only log of every completed row of the mesh.
+ * - <path> is a small header describing the last consistent state of the simulation.
+ *
+ * Each checkpoint only appends the rows computed since the previous one, then atomically replaces the header.
+ * A crash mid-write therefore leaves the previous checkpoint intact.
+ *
+ * @tparam T Numeric type of the mesh being checkpointed.
+ */
+template<typename T>
+requires Numeric<T>
+class MeshCheckpoint {
+public:
+    /**
+     * @param path Path of the checkpoint header. The row log is placed alongside it.
+     * @param config_hash Hash of the simulation configuration. Resuming under a different config is refused.
+     * @param interval Number of timesteps between checkpoints, > 0.
+     */
+    MeshCheckpoint(std::string path, uint64_t config_hash, uint32_t interval):
+        _path(std::move(path)), _config_hash(config_hash), _interval(interval), _rows_written(0), _log_bytes(0) {
+        assert(interval > 0);
+    }
+
+    /**
+     * @brief Record the state of the solution if a checkpoint is due.
+     * Should be called by solvers once every row up to and including timestep has been computed.
+     *
+     * @param solution Mesh being solved.
+     * @param timestep Last completed timestep.
+     * @param delta_t Time discretization of the simulation.
+     */
+    void record(const RectangularMesh<T> &solution, uint64_t timestep, double delta_t) {
+        if (timestep % _interval != 0 || timestep + 1 == solution.num_timesteps()) {
+            return;
+        }
+        append_rows(solution, timestep);
+
+        auto header = Header(_config_hash, timestep, delta_t, solution.discretization_size(), _log_bytes,
+            NoiseSymbols<T>::counter());
+        auto staging_path = _path + ".tmp";
+        {
+            std::ofstream f(staging_path, std::ios::binary | std::ios::trunc);
+            cereal::BinaryOutputArchive archive(f);
+            archive(header);
+        }
+        std::filesystem::rename(staging_path, _path);
+    }
+
+    /**
+     * @brief Restore a solution mesh from the last recorded checkpoint.
+     * Exits if the checkpoint was produced by a different simulation.
+     *
+     * @param solution Mesh to fill with every checkpointed row.
+     * @param delta_t Time discretization of the simulation being resumed.
+     * @return The last completed timestep in the restored mesh.
+     */
+    uint64_t restore(RectangularMesh<T> &solution, double delta_t) {
+        auto header = Header();
+        {
+            std::ifstream f(_path, std::ios::binary);
+            if (!f.is_open()) {
+                std::cerr << "Could not open checkpoint " << _path << std::endl;
+                exit(EXIT_FAILURE);
+            }
+            try {
+                cereal::BinaryInputArchive archive(f);
+                archive(header);
+            } catch (const cereal::Exception &e) {
+                std::cerr << "Checkpoint " << _path << " is corrupt: " << e.what() << "!" << std::endl;
+                exit(EXIT_FAILURE);
+            }
+        }
+
+        if (header.version != version || header.config_hash != _config_hash || header.delta_t != delta_t
+            || header.discretization_size != solution.discretization_size() || header.timestep >= solution.num_timesteps()) {
+            std::cerr << "Checkpoint " << _path << " does not match this simulation!" << std::endl;
+            exit(EXIT_FAILURE);
+        }
+
+        // Discard any rows appended after the last consistent header.
+        auto error = std::error_code();
+        auto log_size = std::filesystem::file_size(rows_path(), error);
+        if (error || log_size < header.log_bytes) {
+            std::cerr << "Checkpoint rows " << rows_path() << " are missing or truncated!" << std::endl;
+            exit(EXIT_FAILURE);
+        }
+        std::filesystem::resize_file(rows_path(), header.log_bytes, error);
+        std::ifstream f(rows_path(), std::ios::binary);
+        if (error || !f.is_open()) {
+            std::cerr << "Could not open checkpoint rows " << rows_path() << "!" << std::endl;
+            exit(EXIT_FAILURE);
+        }
+        try {
+            cereal::BinaryInputArchive archive(f);
+            auto row = std::vector<T>();
+            for (uint64_t timestep = 0; timestep <= header.timestep; timestep++) {
+                archive(row);
+                if (row.size() != solution.discretization_size()) {
+                    std::cerr << "Checkpoint rows " << rows_path() << " are corrupt!" << std::endl;
+                    exit(EXIT_FAILURE);
+                }
+                for (uint64_t x = 0; x < solution.discretization_size(); x++) {
+                    solution.set(timestep, x, std::move(row[x]));
+                }
+            }
+        } catch (const cereal::Exception &e) {
+            std::cerr << "Checkpoint rows " << rows_path() << " are corrupt: " << e.what() << "!" << std::endl;
+            exit(EXIT_FAILURE);
+        }
+
+        NoiseSymbols<T>::restore(header.noise_counter);
+        _rows_written = header.timestep + 1;
+        _log_bytes = header.log_bytes;
+        return header.timestep;
+    }
+
+private:
+    /*
+     * Bumped whenever the on-disk layout changes.
+     */
+    static constexpr uint32_t version = 2;
+
+    std::string _path;
+    uint64_t _config_hash;
+    uint32_t _interval;
+    // Number of rows currently in the row log.
+    uint64_t _rows_written;
+    // Size of the row log as of the last consistent header.
+    uint64_t _log_bytes;
+
+    std::string rows_path() const {
+        return _path + ".rows";
+    }
+
+    /**
+     * Append every row not yet in the log, up to and including timestep.
+     */
+    void append_rows(const RectangularMesh<T> &solution, uint64_t timestep) {
+        auto mode = _rows_written == 0 ? std::ios::binary | std::ios::trunc : std::ios::binary | std::ios::app;
+        std::ofstream f(rows_path(), mode);
+        // Inner scope needed to ensure proper flushing.
+        {
+            cereal::BinaryOutputArchive archive(f);
+            auto row = std::vector<T>(solution.discretization_size());
+            for (; _rows_written <= timestep; _rows_written++) {
+                for (uint64_t x = 0; x < solution.discretization_size(); x++) {
+                    row[x] = solution.get(_rows_written, x);
+                }
+                archive(row);
+            }
+        }
+        f.close();
+        _log_bytes = std::filesystem::file_size(rows_path());
+    }
+
+    /**
+     * State of the simulation as of the last checkpoint.
+     */
+    struct Header {
+        uint32_t version;
+        uint64_t config_hash;
+        uint64_t timestep;
+        double delta_t;
+        uint64_t discretization_size;
+        uint64_t log_bytes;
+        uint64_t noise_counter;
+
+        Header(uint64_t config_hash, uint64_t timestep, double delta_t, uint64_t discretization_size, uint64_t log_bytes, uint64_t noise_counter):
+            version(MeshCheckpoint::version), config_hash(config_hash), timestep(timestep), delta_t(delta_t),
+            discretization_size(discretization_size), log_bytes(log_bytes), noise_counter(noise_counter) {}
+
+        /**
+         * Dummy constructor for reading in deserialized values.
+         */
+        Header(): version(0), config_hash(0), timestep(0), delta_t(0), discretization_size(0), log_bytes(0), noise_counter(0) {}
+
+        template<class Archive>
+        void serialize(Archive & archive) {
+            archive(version, config_hash, timestep, delta_t, discretization_size, log_bytes, noise_counter);
+        }
+    };
+};
+
+#endif //PDENCLOSE_MESHCHECKPOINT_H
@@ -0,0 +1,210 @@
+//
+// Created by will on 12/10/25.
+//
+
+#ifndef PDENCLOSE_PLANARMESH_H
+#define PDENCLOSE_PLANARMESH_H
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+#include "BoundaryCondition.hpp"
+#include "MeshAllocation.hpp"
+#include "domains/Numeric.hpp"
+
+/**
+ * State of a two dimensional system at one instant, over a structured grid of width x height cells.
+ * Unlike RectangularMesh, only one timestep is held, as a 2d solution over every timestep would rarely fit in memory.
+ *
+ * Cells are stored row by row, so cells adjacent in x are adjacent in memory, and cells adjacent in y are one row stride
+ * apart. Each row is padded with ghost cells on either side and starts on a cache line, and the grid is padded with
+ * ghost rows above and below. So, solvers may sweep the grid in rectangular tiles: each tile spans whole cache lines,
+ * and its rows stay cached while a tile is swept in y.
+ *
+ * Ghost corners are never filled, as dimensionally split stencils only read along one axis at a time.
+ *
+ * @tparam T Numeric type to approximate system.
+ */
+template<typename T>
+requires Numeric<T>
+class PlanarMesh {
+public:
+    /*
+     * Constructors
+     */
+
+    /**
+     * @param width Number of cells in x, > 0.
+     * @param height Number of cells in y, > 0.
+     * @param ghost_cells Number of ghost cells padding each edge of the grid.
+     */
+    PlanarMesh(uint64_t width, uint64_t height, uint32_t ghost_cells = 0):
+        _width(width), _height(height), _ghost_cells(ghost_cells), _row_stride(aligned_row_stride<T>(width + 2 * ghost_cells)) {
+        assert(width > 0);
+        assert(height > 0);
+        _cells = allocate_cells<T>(num_rows(), _row_stride, 0, width + 2 * ghost_cells, ghost_cells, ghost_cells + width);
+    }
+
+    /**
+     * Meshes own their cells, so are moved rather than copied.
+     */
+    PlanarMesh(PlanarMesh &&other) noexcept: _width(other._width), _height(other._height), _ghost_cells(other._ghost_cells),
+        _row_stride(other._row_stride), _cells(other._cells) {
+        other._cells = nullptr;
+    }
+    PlanarMesh(const PlanarMesh &) = delete;
+
+    PlanarMesh &operator=(PlanarMesh &&other) noexcept {
+        std::swap(_width, other._width);
+        std::swap(_height, other._height);
+        std::swap(_ghost_cells, other._ghost_cells);
+        std::swap(_row_stride, other._row_stride);
+        std::swap(_cells, other._cells);
+        return *this;
+    }
+
+    ~PlanarMesh() {
+        free_cells(_cells, num_rows(), _row_stride, 0, _width + 2 * _ghost_cells);
+        _cells = nullptr;
+    }
+
+    /**
+     * @brief Copy the interior cells of another mesh of the same size, i.e. into a mesh with more ghost cells.
+     */
+    void copy_cells(const PlanarMesh &other) {
+        assert(other._width == _width && other._height == _height);
+        auto width = static_cast<int64_t>(_width);
+        auto height = static_cast<int64_t>(_height);
+#       pragma omp parallel for default(none) shared(other, width, height) schedule(static)
+        for (int64_t y = 0; y < height; y++) {
+            auto source = other.row(y);
+            auto destination = row(y);
+            for (int64_t x = 0; x < width; x++) {
+                destination[x] = source[x];
+            }
+        }
+    }
+
+    /*
+     * Accessors
+     */
+    uint64_t width() const {
+        return _width;
+    }
+    uint64_t height() const {
+        return _height;
+    }
+    uint32_t ghost_cells() const {
+        return _ghost_cells;
+    }
+    /**
+     * @return Number of cells between vertically adjacent cells.
+     */
+    uint64_t row_stride() const {
+        return _row_stride;
+    }
+
+    const T &get(uint64_t x, uint64_t y) const {
+        assert(x < _width && y < _height);
+        return row(y)[x];
+    }
+    void set(uint64_t x, uint64_t y, const T &value) {
+        assert(x < _width && y < _height);
+        row(y)[x] = value;
+    }
+    void set(uint64_t x, uint64_t y, T &&value) {
+        assert(x < _width && y < _height);
+        row(y)[x] = std::move(value);
+    }
+
+    /**
+     * @param y Row, from -ghost_cells to height + ghost_cells, the outermost being ghost rows.
+     * @return Pointer to the first interior cell of a row.
+     * Indices [-ghost_cells, width + ghost_cells) are valid, the outermost being ghost cells.
+     */
+    T *row(int64_t y) {
+        assert(y >= -static_cast<int64_t>(_ghost_cells) && y < static_cast<int64_t>(_height + _ghost_cells));
+        return _cells + cell_offset(y + _ghost_cells, 0, _row_stride, _ghost_cells);
+    }
+    const T *row(int64_t y) const {
+        assert(y >= -static_cast<int64_t>(_ghost_cells) && y < static_cast<int64_t>(_height + _ghost_cells));
+        return _cells + cell_offset(y + _ghost_cells, 0, _row_stride, _ghost_cells);
+    }
+
+    /*
+     * Boundaries
+     */
+
+    /**
+     * @brief Fill the ghost cells at the left and right of every row.
+     */
+    void fill_row_ghosts(const BoundaryCondition<T> &boundary) {
+        auto height = static_cast<int64_t>(_height);
+#       pragma omp parallel for default(none) shared(boundary, height) schedule(static)
+        for (int64_t y = 0; y < height; y++) {
+            boundary.fill(row(y), _width, _ghost_cells);
+        }
+    }
+
+    /**
+     * @brief Fill the ghost rows above and below the grid, treating each column as a row of a 1d system.
+     * Boundary conditions only read within ghost_cells of each edge, so each column is filled through a short buffer
+     * holding its edges, rather than gathering the whole column.
+     */
+    void fill_column_ghosts(const BoundaryCondition<T> &boundary) {
+        assert(_height >= 2 * _ghost_cells);
+        auto width = static_cast<int64_t>(_width);
+        int64_t ghosts = _ghost_cells;
+        auto height = static_cast<int64_t>(_height);
+#       pragma omp parallel default(none) shared(boundary, width, ghosts, height)
+        {
+            // Ghosts, the first and last ghost_cells cells of the column, then ghosts.
+            auto column = std::vector<T>(4 * ghosts);
+            auto edges = column.data() + ghosts;
+#           pragma omp for schedule(static)
+            for (int64_t x = 0; x < width; x++) {
+                for (int64_t k = 0; k < ghosts; k++) {
+                    edges[k] = row(k)[x];
+                    edges[ghosts + k] = row(height - ghosts + k)[x];
+                }
+                boundary.fill(edges, 2 * ghosts, ghosts);
+                for (int64_t k = 1; k <= ghosts; k++) {
+                    row(-k)[x] = edges[-k];
+                    row(height - 1 + k)[x] = edges[2 * ghosts - 1 + k];
+                }
+            }
+        }
+    }
+
+    /*
+     * Output
+     */
+
+    /**
+     * @brief Print each row of the system, from y = 0.
+     */
+    void print_system() const {
+        for (uint64_t y = 0; y < _height; y++) {
+            std::cout << "Y" << y << ": ";
+            for (uint64_t x = 0; x < _width; x++) {
+                std::cout << get(x, y) << " ";
+            }
+            std::cout << std::endl;
+        }
+    }
+
+private:
+    uint64_t _width;
+    uint64_t _height;
+    uint32_t _ghost_cells;
+    uint64_t _row_stride;
+    T *_cells;
+
+    uint64_t num_rows() const {
+        return _height + 2 * _ghost_cells;
+    }
+};
+
+#endif //PDENCLOSE_PLANARMESH_H
@@ -4,10 +4,29 @@
 
 #ifndef PDENCLOSE_RECTANGULARMESH_H
 #define PDENCLOSE_RECTANGULARMESH_H
+#include <algorithm>
 #include <cassert>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
 #include <cstring>
+#include <exception>
 #include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "MeshAllocation.hpp"
 #include "domains/Numeric.hpp"
 
 #include "cereal/archives/json.hpp"
@@ -19,6 +38,11 @@
 /**
  * Discretization of a physical system represented by a hyperbolic PDE.
  * This mesh uses a fixed spatial dimension, ideal for finite difference methods.
+ *
+ * Each row may be padded with ghost cells on either side, which a BoundaryCondition fills before the row is read.
+ * Stencils may then read past either edge of a row, so solvers sweep every cell in one uniform loop.
+ * Ghost cells are not part of the system: they are never compared or serialized.
+ *
  * @param T numeric type to approximate system.
  */
 template<typename T>
@@ -33,15 +57,24 @@ public:
      * Empty discretization matrix.
      * @param discretization_size Number of spatial discretization points, > 0.
      * @param num_timesteps Number of timesteps for this discretization->
+     * @param ghost_cells Number of ghost cells padding each side of every row.
      */
-    RectangularMesh(uint32_t discretization_size, uint32_t num_timesteps)
-        :_discretization_size(discretization_size),  _num_timesteps(num_timesteps) {
+    RectangularMesh(uint64_t discretization_size, uint64_t num_timesteps, uint32_t ghost_cells = 0)
+        :_discretization_size(discretization_size),  _num_timesteps(num_timesteps), _ghost_cells(ghost_cells) {
         assert(discretization_size > 0);
         assert(num_timesteps > 0);
 
-        _system = static_cast<T *>(calloc(sizeof(T), num_timesteps * discretization_size));
-        assert(_system);
+        _system = allocate_cells<T>(num_timesteps, row_stride(), 0, row_size(), ghost_cells, ghost_cells + discretization_size);
+    }
+    /**
+     * Meshes own their cells, so are moved rather than copied.
+     */
+    RectangularMesh(RectangularMesh &&other) noexcept: _system(other._system),
+        _discretization_size(other._discretization_size), _num_timesteps(other._num_timesteps), _ghost_cells(other._ghost_cells) {
+        other._system = nullptr;
     }
+    RectangularMesh(const RectangularMesh &) = delete;
+
     /**
      * Copy initial conditions into discretization matrix.
      * @param initial_conditions Array of starting conditions for the system, of len discretization_size.
@@ -49,90 +82,161 @@ public:
      */
     void copy_initial_conditions(const std::vector<T> &initial_conditions) {
         assert(initial_conditions.size() == discretization_size());
-        for (auto index = 0; index < _discretization_size; index++) {
-            _system[index] = initial_conditions[index];
+        for (uint64_t index = 0; index < _discretization_size; index++) {
+            set(0, index, initial_conditions[index]);
         }
     }
     /**
      * Destructor
      */
     ~RectangularMesh() {
-        free(_system);
+        free_cells(_system, _num_timesteps, row_stride(), 0, row_size());
         _system = nullptr;
     }
 
     /*
      * Accessors
      */
-    uint32_t discretization_size() const {
+    uint64_t discretization_size() const {
         return _discretization_size;
     }
-    uint32_t num_timesteps() const {
+    uint64_t num_timesteps() const {
         return _num_timesteps;
     }
-    T get(uint32_t timestep, uint32_t index) const {
+    uint32_t ghost_cells() const {
+        return _ghost_cells;
+    }
+    /*
+     * Cells are read by reference and may be moved into place, so affine and mixed forms are not copied on every access.
+     */
+    const T &get(uint64_t timestep, uint64_t index) const {
+        assert(timestep < _num_timesteps);
+        assert(index < _discretization_size);
+        return _system[offset(timestep, index)];
+    }
+    void set(uint64_t timestep, uint64_t index, const T &value) {
         assert(timestep < _num_timesteps);
         assert(index < _discretization_size);
-        return _system[timestep * _discretization_size + index];
+        _system[offset(timestep, index)] = value;
     }
-    void set(uint32_t timestep, uint32_t index, T value) {
+    void set(uint64_t timestep, uint64_t index, T &&value) {
         assert(timestep < _num_timesteps);
         assert(index < _discretization_size);
-        _system[timestep * _discretization_size + index] = value;
+        _system[offset(timestep, index)] = std::move(value);
+    }
+
+    /**
+     * @param timestep Timestep of the row.
+     * @return Pointer to the first cell of a row.
+     * Indices [-ghost_cells, discretization_size + ghost_cells) are valid, the outermost being ghost cells.
+     */
+    T *row(uint64_t timestep) {
+        assert(timestep < _num_timesteps);
+        return _system + offset(timestep, 0);
+    }
+    const T *row(uint64_t timestep) const {
+        assert(timestep < _num_timesteps);
+        return _system + offset(timestep, 0);
     }
 
     /*
      * Serialization
+     *
+     * Meshes are stored in the JSON layout cereal produces for {discretization_size, num_timesteps, system}.
+     * However, the system is encoded and decoded in chunks of cells, split between threads,
+     * so no intermediate copy of the entire mesh is ever made.
      */
 
     /**
-     * @return A json representation of this data.
+     * @brief Write a json representation of this data to a file descriptor.
+     * Exits if the descriptor cannot be written to.
+     * @param fd Open, writable file descriptor.
      */
-    std::string to_json_string() {
-        std::ostringstream ss;
-        // Inner scope needed to ensure proper flushing.
-        {
-            cereal::JSONOutputArchive o(ss);
-            o(FixedMeshData(this));
-            ss.flush();
-        }
-        return ss.str();
+    void write_json(int fd) const {
+        encode_json([fd](const std::string &text) {
+            auto remaining = text.size();
+            auto position = text.data();
+            while (remaining > 0) {
+                auto written = ::write(fd, position, remaining);
+                if (written < 0 && errno == EINTR) {
+                    continue;
+                }
+                if (written <= 0) {
+                    std::cerr << "Could not write mesh: " << std::strerror(errno) << std::endl;
+                    exit(EXIT_FAILURE);
+                }
+                remaining -= static_cast<size_t>(written);
+                position += written;
+            }
+        });
     }
 
     /**
-     * @param strrep JSON string representation of a discretization.
-     * @return A new discretization object created from this string.
+     * @brief Read a discretization from a file descriptor containing its json representation.
+     * The file is mapped into memory rather than read into a buffer.
+     *
+     * Exits if the file cannot be mapped, or does not hold a mesh.
+     *
+     * @param fd Open, readable file descriptor of a regular file.
+     * @return A new discretization object created from the file.
      */
-    static RectangularMesh from_json_string(const std::string &strrep) {
-        auto input = std::istringstream(strrep);
-        FixedMeshData data_tuple = FixedMeshData();
-        // Place in inner scope to ensure proper flushing.
-        {
-            cereal::JSONInputArchive archive(input);
-            archive(data_tuple);
+    static RectangularMesh read_json(int fd) {
+        struct stat file_stats{};
+        if (fstat(fd, &file_stats) != 0) {
+            std::cerr << "Could not read mesh: " << std::strerror(errno) << std::endl;
+            exit(EXIT_FAILURE);
+        }
+        if (!S_ISREG(file_stats.st_mode) || file_stats.st_size <= 0) {
+            std::cerr << "Could not read mesh: not a nonempty regular file!" << std::endl;
+            exit(EXIT_FAILURE);
         }
 
-        // Manual deep copy to handle unordered maps in affine forms.
-        // NOTE: simple memcpy does not cut it -- we need to call copy constructor!
-        auto data = static_cast<T *>(calloc(data_tuple.discretization_size * data_tuple.num_timesteps, sizeof(T)));
-        for (auto i = 0; i < data_tuple.discretization_size * data_tuple.num_timesteps; i++) {
-            data[i] = data_tuple.system[i];
+        auto size = static_cast<size_t>(file_stats.st_size);
+        auto mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping == MAP_FAILED) {
+            std::cerr << "Could not map mesh: " << std::strerror(errno) << std::endl;
+            exit(EXIT_FAILURE);
         }
 
-        return RectangularMesh(data_tuple.discretization_size, data_tuple.num_timesteps, data);
+        auto mesh = decode_json(static_cast<const char *>(mapping), size);
+        munmap(mapping, size);
+        return mesh;
+    }
+
+    /**
+     * @return A json representation of this data.
+     */
+    std::string to_json_string() const {
+        std::string json;
+        encode_json([&json](const std::string &text) {
+            json += text;
+        });
+        return json;
+    }
+
+    /**
+     * @param strrep JSON string representation of a discretization.
+     * @return A new discretization object created from this string.
+     */
+    static RectangularMesh from_json_string(const std::string &strrep) {
+        return decode_json(strrep.data(), strrep.size());
     }
 
     /*
      * Assorted helpers
      */
 
-    void print_system() const {
-        for (auto t = 0; t < _num_timesteps; t++) {
-            std::cout << "T" << t << ": ";
-            for (auto i = 0; i < _discretization_size; i++) {
-                std::cout << _system[_discretization_size * t + i] << " ";
+    /**
+     * @brief Print each row of the system, one line per timestep.
+     * @param out Stream to print to.
+     */
+    void print_system(std::ostream &out = std::cout) const {
+        for (uint64_t t = 0; t < _num_timesteps; t++) {
+            out << "T" << t << ": ";
+            for (uint64_t i = 0; i < _discretization_size; i++) {
+                out << get(t, i) << " ";
             }
-            std::cout << std::endl;
+            out << std::endl;
         }
     }
 
@@ -141,9 +245,11 @@ public:
             return false;
         }
 
-        for (auto i = 0; i < _discretization_size * _num_timesteps; i++) {
-            if (other._system[i] != _system[i]) {
-                return false;
+        for (uint64_t t = 0; t < _num_timesteps; t++) {
+            for (uint64_t i = 0; i < _discretization_size; i++) {
+                if (other.get(t, i) != get(t, i)) {
+                    return false;
+                }
             }
         }
 
@@ -153,55 +259,268 @@ public:
 private:
     // Using raw pointer to enable low-level mem management -- i.e. transfer to GPU
     T *_system;
-    const uint32_t _discretization_size;
-    const uint32_t _num_timesteps;
+    const uint64_t _discretization_size;
+    const uint64_t _num_timesteps;
+    const uint32_t _ghost_cells;
+
+    /**
+     * @return Number of cells in a row, including its ghost cells.
+     */
+    uint64_t row_size() const {
+        return _discretization_size + 2 * static_cast<uint64_t>(_ghost_cells);
+    }
+
+    /**
+     * @return Number of cells between the starts of consecutive rows. Rows are padded to start on a cache line.
+     */
+    uint64_t row_stride() const {
+        return aligned_row_stride<T>(row_size());
+    }
 
     /**
-     * Internal data tuple for reading/writing
+     * @return Position of a cell in the system array. Index may address ghost cells.
      */
-    struct FixedMeshData {
-        uint32_t discretization_size;
-        uint32_t num_timesteps;
-        std::vector<T> system;
+    uint64_t offset(uint64_t timestep, int64_t index) const {
+        return cell_offset(timestep, index, row_stride(), _ghost_cells);
+    }
 
-        /**
-         * @param discretization Discretization to construct into serializable form.
-         */
-        explicit FixedMeshData(const RectangularMesh *discretization):
-            discretization_size(discretization->discretization_size()), num_timesteps(discretization->num_timesteps()),
-            system(std::vector<T>(discretization->discretization_size() * discretization->num_timesteps())) {
+    /*
+     * Number of cells encoded or decoded by a thread at once.
+     * Large enough to amortize archive setup, small enough to balance between threads.
+     */
+    static constexpr uint32_t json_chunk_size = 4096;
 
-            for (auto i = 0; i < discretization->discretization_size() * discretization->num_timesteps(); i++) {
-                system[i] = discretization->_system[i];
+    /**
+     * @return Number of chunks which may be in flight at once.
+     */
+    static uint32_t json_chunks_in_flight() {
+#       ifdef _OPENMP
+        return omp_get_max_threads();
+#       else
+        return 1;
+#       endif
+    }
+
+    /**
+     * @brief Encode cells [begin, end) of the system as comma separated json values.
+     */
+    std::string encode_cells(uint64_t begin, uint64_t end) const {
+        // Cereal can only write complete documents, so encode the chunk as a vector and strip the enclosing document.
+        // Cells are numbered row by row, skipping ghost cells.
+        auto cells = std::vector<T>();
+        cells.reserve(end - begin);
+        for (auto cell = begin; cell < end; cell++) {
+            cells.push_back(_system[offset(cell / _discretization_size, cell % _discretization_size)]);
+        }
+        std::ostringstream ss;
+        // Inner scope needed to ensure proper flushing.
+        {
+            cereal::JSONOutputArchive archive(ss, cereal::JSONOutputArchive::Options::NoIndent());
+            archive(cells);
+        }
+        auto text = ss.str();
+        auto open = text.find('[');
+        auto close = text.rfind(']');
+        return text.substr(open + 1, close - open - 1);
+    }
+
+    /**
+     * @brief Encode the mesh as json, passing the text to sink in order.
+     * Chunks are encoded in parallel one wave at a time, so memory use is bounded by the size of a wave.
+     *
+     * @param sink Callable accepting successive pieces of the json text.
+     */
+    template<typename Sink>
+    void encode_json(Sink &&sink) const {
+        std::ostringstream header;
+        header << "{\n    \"value0\": {\n"
+            << "        \"discretization_size\": " << _discretization_size << ",\n"
+            << "        \"num_timesteps\": " << _num_timesteps << ",\n"
+            << "        \"system\": [";
+        sink(header.str());
+
+        uint64_t num_cells = _discretization_size * _num_timesteps;
+        uint64_t num_chunks = (num_cells + json_chunk_size - 1) / json_chunk_size;
+        uint64_t wave_size = json_chunks_in_flight();
+        auto wave = std::vector<std::string>(wave_size);
+
+        for (uint64_t wave_start = 0; wave_start < num_chunks; wave_start += wave_size) {
+            uint64_t wave_end = std::min(wave_start + wave_size, num_chunks);
+
+#           pragma omp parallel for default(none) shared(wave, wave_start, wave_end, num_cells)
+            for (uint64_t chunk = wave_start; chunk < wave_end; chunk++) {
+                auto begin = chunk * json_chunk_size;
+                wave[chunk - wave_start] = encode_cells(begin, std::min(begin + json_chunk_size, num_cells));
             }
+
+            for (uint64_t chunk = wave_start; chunk < wave_end; chunk++) {
+                if (chunk > 0) {
+                    sink(",");
+                }
+                sink(wave[chunk - wave_start]);
+            }
+        }
+        sink("]\n    }\n}\n");
+    }
+
+    /**
+     * @brief Exit, reporting a malformed json mesh.
+     */
+    [[noreturn]] static void malformed_json(const std::string &reason) {
+        std::cerr << "Malformed mesh: " << reason << "!" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+
+    /**
+     * @brief Read an unsigned integer field from the header of a json mesh. Exits if it is missing.
+     */
+    static uint64_t decode_header_field(std::string_view header, const std::string &name) {
+        auto position = header.find("\"" + name + "\"");
+        if (position != std::string_view::npos) {
+            position = header.find(':', position);
         }
+        if (position == std::string_view::npos) {
+            malformed_json("missing " + name);
+        }
+
+        // The header is not null terminated, so copy the digits out before parsing.
+        auto digits = header.substr(position + 1);
+        digits.remove_prefix(std::min(digits.find_first_not_of(" \t\r\n"), digits.size()));
+        digits = digits.substr(0, digits.find_first_not_of("0123456789"));
+        if (digits.empty() || digits.size() > 19) {
+            malformed_json("invalid " + name);
+        }
+        return std::stoull(std::string(digits));
+    }
 
-        /**
-         * Dummy constructor for reading in deserialized values.
-         */
-        FixedMeshData(): discretization_size(0), num_timesteps(0), system(std::vector<T>()) {}
+    /**
+     * @brief Find where each chunk of cells begins in the system array of a json mesh.
+     *
+     * @param system Text starting just after the opening bracket of the system array.
+     * @return Offsets of the first cell of each chunk, followed by the offset of the closing bracket.
+     */
+    static std::vector<size_t> find_chunk_offsets(std::string_view system) {
+        auto offsets = std::vector<size_t>{0};
+        uint64_t cells = 0;
+        auto depth = 0;
+        auto in_string = false;
 
-        /*
-         * Serialization support
-         */
-        template<class Archive>
-        void serialize(Archive & archive) {
-            archive(cereal::make_nvp("discretization_size", discretization_size),
-                cereal::make_nvp("num_timesteps", num_timesteps),
-                cereal::make_nvp("system", system));
+        for (size_t i = 0; i < system.size(); i++) {
+            auto c = system[i];
+            if (in_string) {
+                if (c == '\\') {
+                    i++;
+                } else if (c == '"') {
+                    in_string = false;
+                }
+                continue;
+            }
+
+            switch (c) {
+                case '"':
+                    in_string = true;
+                    break;
+                case '{':
+                case '[':
+                    depth++;
+                    break;
+                case '}':
+                case ']':
+                    if (depth == 0) {
+                        // Closing bracket of the system array.
+                        offsets.push_back(i);
+                        return offsets;
+                    }
+                    depth--;
+                    break;
+                case ',':
+                    if (depth == 0 && ++cells % json_chunk_size == 0) {
+                        offsets.push_back(i + 1);
+                    }
+                    break;
+                default:
+                    break;
+            }
         }
-    };
+        malformed_json("unterminated system array");
+    }
 
     /**
-     * Explicit value constructor -- internal only!
+     * @brief Decode a json mesh, parsing chunks of cells in parallel.
+     * The decoded mesh has no ghost cells. Exits if the text is not a mesh.
      *
-     * @param discretization_size Size of discretization, > 0.
-     * @param num_timesteps Number of timesteps for this discretization->
-     * @param system Array of starting conditions for the system, of len discretization_size.
+     * @param json Text of the mesh.
+     * @param size Length of the text.
+     * @return A new discretization object created from the text.
      */
-    RectangularMesh(uint32_t discretization_size, uint32_t num_timesteps, T *system):
-        _discretization_size(discretization_size), _num_timesteps(num_timesteps), _system(system) {
-        assert(system);
+    static RectangularMesh decode_json(const char *json, size_t size) {
+        auto text = std::string_view(json, size);
+        auto system_position = text.find("\"system\"");
+        if (system_position == std::string_view::npos) {
+            malformed_json("missing system");
+        }
+
+        auto header = text.substr(0, system_position);
+        auto discretization_size = decode_header_field(header, "discretization_size");
+        auto num_timesteps = decode_header_field(header, "num_timesteps");
+        if (discretization_size == 0 || num_timesteps == 0 || num_timesteps > UINT64_MAX / discretization_size) {
+            malformed_json("invalid dimensions");
+        }
+        uint64_t num_cells = discretization_size * num_timesteps;
+
+        auto array_position = text.find('[', system_position);
+        if (array_position == std::string_view::npos) {
+            malformed_json("missing system array");
+        }
+        auto system = text.substr(array_position + 1);
+        auto offsets = find_chunk_offsets(system);
+        uint64_t num_chunks = offsets.size() - 1;
+        if (num_chunks != (num_cells + json_chunk_size - 1) / json_chunk_size) {
+            malformed_json("number of cells does not match dimensions");
+        }
+
+        auto mesh = RectangularMesh(discretization_size, num_timesteps);
+        // Exceptions cannot leave a parallel region, so failures are recorded, then reported after it.
+        auto failed = false;
+
+#       pragma omp parallel for default(none) shared(system, offsets, num_chunks, num_cells, discretization_size, mesh, failed)
+        for (uint64_t chunk = 0; chunk < num_chunks; chunk++) {
+            auto end = offsets[chunk + 1];
+            // Drop the separator between this chunk and the next.
+            if (chunk + 1 < num_chunks) {
+                end--;
+            }
+
+            // Wrap the chunk as a complete document so cereal can parse it.
+            auto input = std::istringstream(
+                "{\"value0\":[" + std::string(system.substr(offsets[chunk], end - offsets[chunk])) + "]}");
+            auto cells = std::vector<T>();
+            // The try block is an inner scope, so the archive is flushed before cells are read.
+            try {
+                cereal::JSONInputArchive archive(input);
+                archive(cells);
+            } catch (const std::exception &) {
+#               pragma omp atomic write
+                failed = true;
+                continue;
+            }
+
+            auto begin = chunk * json_chunk_size;
+            if (cells.size() != std::min<uint64_t>(json_chunk_size, num_cells - begin)) {
+#               pragma omp atomic write
+                failed = true;
+                continue;
+            }
+            for (uint64_t i = 0; i < cells.size(); i++) {
+                auto cell = begin + i;
+                mesh.set(cell / discretization_size, cell % discretization_size, std::move(cells[i]));
+            }
+        }
+
+        if (failed) {
+            malformed_json("could not parse cells");
+        }
+        return mesh;
     }
 };
 
@@ -0,0 +1,113 @@
+//
+// Created by will on 12/10/25.
+//
+
+#ifndef PDENCLOSE_SYSTEMMESH_H
+#define PDENCLOSE_SYSTEMMESH_H
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include "RectangularMesh.hpp"
+#include "domains/Numeric.hpp"
+#include "flux/SystemFluxFunction.hpp"
+
+/**
+ * Solution of a system of M conservation laws, over every timestep.
+ *
+ * Components are stored apart (structure of arrays): each is its own mesh, with its own aligned rows.
+ * So, schemes sweep each component with unit stride, rather than striding over the other components of each cell.
+ *
+ * @tparam T Numeric type of each component.
+ * @tparam M Number of conserved quantities.
+ */
+template<typename T, size_t M>
+requires Numeric<T>
+class SystemMesh {
+public:
+    static constexpr size_t components = M;
+
+    /**
+     * @param discretization_size Number of cells, > 0.
+     * @param num_timesteps Number of timesteps, > 0.
+     * @param ghost_cells Number of ghost cells on either side of each row of each component.
+     */
+    SystemMesh(uint64_t discretization_size, uint64_t num_timesteps, uint32_t ghost_cells = 0) {
+        _components.reserve(M);
+        for (size_t c = 0; c < M; c++) {
+            _components.emplace_back(discretization_size, num_timesteps, ghost_cells);
+        }
+    }
+
+    /**
+     * @param initial_conditions Initial values of each component, each of len discretization_size.
+     */
+    void copy_initial_conditions(const std::array<std::vector<T>, M> &initial_conditions) {
+        for (size_t c = 0; c < M; c++) {
+            _components[c].copy_initial_conditions(initial_conditions[c]);
+        }
+    }
+
+    /*
+     * Accessors
+     */
+    uint64_t discretization_size() const {
+        return _components[0].discretization_size();
+    }
+    uint64_t num_timesteps() const {
+        return _components[0].num_timesteps();
+    }
+    uint32_t ghost_cells() const {
+        return _components[0].ghost_cells();
+    }
+
+    RectangularMesh<T> &component(size_t c) {
+        assert(c < M);
+        return _components[c];
+    }
+    const RectangularMesh<T> &component(size_t c) const {
+        assert(c < M);
+        return _components[c];
+    }
+
+    /**
+     * @return Every component of a cell, gathered into one state.
+     */
+    SystemState<T, M> get(uint64_t timestep, uint64_t index) const {
+        auto state = SystemState<T, M>();
+        for (size_t c = 0; c < M; c++) {
+            state[c] = _components[c].get(timestep, index);
+        }
+        return state;
+    }
+    void set(uint64_t timestep, uint64_t index, const SystemState<T, M> &state) {
+        for (size_t c = 0; c < M; c++) {
+            _components[c].set(timestep, index, state[c]);
+        }
+    }
+
+    /**
+     * @brief Print each row of the system, one line per timestep, with each cell's components in parentheses.
+     * @param out Stream to print to.
+     */
+    void print_system(std::ostream &out = std::cout) const {
+        for (uint64_t t = 0; t < num_timesteps(); t++) {
+            out << "T" << t << ": ";
+            for (uint64_t i = 0; i < discretization_size(); i++) {
+                out << "(";
+                for (size_t c = 0; c < M; c++) {
+                    out << _components[c].get(t, i) << (c + 1 < M ? ", " : ") ");
+                }
+            }
+            out << std::endl;
+        }
+    }
+
+private:
+    std::vector<RectangularMesh<T>> _components;
+};
+
+#endif //PDENCLOSE_SYSTEMMESH_H
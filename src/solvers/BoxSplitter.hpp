@@ -0,0 +1,286 @@
+//
+// Created by will on 12/5/25.
+//
+
+#ifndef PDENCLOSE_BOXSPLITTER_H
+#define PDENCLOSE_BOXSPLITTER_H
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "domains/Enclosure.hpp"
+#include "domains/Numeric.hpp"
+#include "meshes/RectangularMesh.hpp"
+
+#include "Winterval/Winterval.hpp"
+
+/**
+ * Tightens enclosures by splitting the initial uncertainty of a system into sub-boxes.
+ *
+ * Enclosures grow with the width of their inputs, so solving several narrow boxes and taking the hull of their results
+ * is tighter than solving one wide box. Every initial state lies in some sub-box, so the hull remains sound.
+ *
+ * Boxes are refined adaptively: the boxes whose solutions are widest are bisected first, and each wave of bisections
+ * is solved in parallel, one box per thread.
+ *
+ * Only the final row of each box's solution guides refinement, so boxes keep just its widest cell.
+ * Solutions of final boxes are folded into a running hull as soon as they are solved, so no more than one mesh per
+ * thread is held at once. Boxes of the last wave are known to be final when solved. Earlier boxes left unsplit are
+ * solved once more at the end, trading some solves for memory independent of the number of boxes.
+ *
+ * @tparam T Numeric type of the enclosure.
+ */
+template<typename T>
+requires Numeric<T>
+class BoxSplitter {
+public:
+    /**
+     * @param max_boxes Number of sub-boxes to refine to, > 0.
+     */
+    explicit BoxSplitter(uint32_t max_boxes): _max_boxes(max_boxes) {
+        assert(max_boxes > 0);
+    }
+
+    /**
+     * @brief Enclose a system by solving sub-boxes of its initial state.
+     *
+     * @param initial_state Initial state of the system. Its bounds are the box to split.
+     * @param solve_box Callable solving the system from an initial state, returning a RectangularMesh<T>.
+     * Called concurrently from several threads, and possibly more than once for the same state.
+     * @return The per-cell hull of the solutions of every sub-box.
+     */
+    template<typename Solve>
+    RectangularMesh<Winterval> solve(const std::vector<T> &initial_state, Solve &&solve_box) {
+        auto root = Box();
+        for (const auto &value : initial_state) {
+            auto bounds = Enclosure<T>::bounds(value);
+            root.lower.push_back(bounds.min());
+            root.upper.push_back(bounds.max());
+        }
+
+        _hull_min.clear();
+        _hull_max.clear();
+        auto leaves = std::vector<Box>{root};
+        solve_boxes(leaves, solve_box, _max_boxes == 1);
+
+        while (leaves.size() < _max_boxes) {
+            std::stable_sort(leaves.begin(), leaves.end(), [](const Box &a, const Box &b) {
+                return a.width > b.width;
+            });
+
+            // Each bisection adds one box. Only bisect as many boxes as can be solved at once.
+            auto num_splits = std::min<uint64_t>(_max_boxes - leaves.size(), boxes_in_flight());
+            auto next_leaves = std::vector<Box>();
+            auto children = std::vector<Box>();
+            for (auto &leaf : leaves) {
+                auto dimension = split_dimension(leaf);
+                if (children.size() / 2 < num_splits && dimension < leaf.lower.size()) {
+                    bisect(leaf, dimension, children);
+                } else {
+                    next_leaves.push_back(std::move(leaf));
+                }
+            }
+
+            // Every box is a single point: no further refinement is possible.
+            if (children.empty()) {
+                leaves = std::move(next_leaves);
+                break;
+            }
+
+            // Refinement stops once there are enough boxes, so the last wave's boxes are final.
+            solve_boxes(children, solve_box, next_leaves.size() + children.size() >= _max_boxes);
+            for (auto &child : children) {
+                next_leaves.push_back(std::move(child));
+            }
+            leaves = std::move(next_leaves);
+        }
+
+        auto unfolded = std::vector<Box>();
+        for (auto &leaf : leaves) {
+            if (!leaf.folded) {
+                unfolded.push_back(std::move(leaf));
+            }
+        }
+        if (!unfolded.empty()) {
+            solve_boxes(unfolded, solve_box, true);
+        }
+        return hull();
+    }
+
+private:
+    uint32_t _max_boxes;
+    uint64_t _discretization_size = 0;
+    uint64_t _num_timesteps = 0;
+    // Bounds of each cell of the hull of every final box's solution, row by row.
+    std::vector<double> _hull_min;
+    std::vector<double> _hull_max;
+
+    /**
+     * A sub-box of the initial state, along with the widest cell of its solution.
+     */
+    struct Box {
+        // Bounds of each cell of the initial state.
+        std::vector<double> lower;
+        std::vector<double> upper;
+        // Width of the widest cell in the final row of the solution, and its index.
+        double width = 0;
+        uint64_t widest_cell = 0;
+        // Whether the solution is already part of the hull.
+        bool folded = false;
+    };
+
+    /**
+     * @return Number of boxes which may be solved at once.
+     */
+    static uint64_t boxes_in_flight() {
+#       ifdef _OPENMP
+        return omp_get_max_threads();
+#       else
+        return 1;
+#       endif
+    }
+
+    /**
+     * @brief Choose the input cell to bisect a box along.
+     * The widest cell is chosen, favoring those nearest where the solution is widest.
+     *
+     * @return Index of the cell to bisect, or the size of the box if every cell is a single point.
+     */
+    static uint64_t split_dimension(const Box &box) {
+        auto widest = 0.0;
+        for (uint64_t x = 0; x < box.lower.size(); x++) {
+            widest = std::max(widest, box.upper[x] - box.lower[x]);
+        }
+        if (widest <= 0) {
+            return box.lower.size();
+        }
+
+        uint64_t dimension = box.lower.size();
+        auto nearest = std::numeric_limits<int64_t>::max();
+        for (uint64_t x = 0; x < box.lower.size(); x++) {
+            auto distance = std::abs(static_cast<int64_t>(x) - static_cast<int64_t>(box.widest_cell));
+            if (box.upper[x] - box.lower[x] == widest && distance < nearest) {
+                dimension = x;
+                nearest = distance;
+            }
+        }
+        return dimension;
+    }
+
+    /**
+     * @brief Split a box in half along one cell, appending both halves to children.
+     */
+    static void bisect(const Box &box, uint64_t dimension, std::vector<Box> &children) {
+        auto midpoint = (box.lower[dimension] + box.upper[dimension]) / 2;
+
+        auto left = Box();
+        left.lower = box.lower;
+        left.upper = box.upper;
+        left.upper[dimension] = midpoint;
+
+        auto right = Box();
+        right.lower = box.lower;
+        right.upper = box.upper;
+        right.lower[dimension] = midpoint;
+
+        children.push_back(std::move(left));
+        children.push_back(std::move(right));
+    }
+
+    /**
+     * @brief Solve each box in parallel, recording the widest cell of its solution.
+     *
+     * @param fold Whether the boxes are final, so their solutions are folded into the hull.
+     */
+    template<typename Solve>
+    void solve_boxes(std::vector<Box> &boxes, Solve &solve_box, bool fold) {
+        auto num_boxes = boxes.size();
+        auto &hull_min = _hull_min;
+        auto &hull_max = _hull_max;
+
+        // Solvers parallelize internally as well; nested regions run serially, so each box is solved by one thread.
+#       pragma omp parallel for default(none) shared(boxes, num_boxes, solve_box, fold, hull_min, hull_max) schedule(dynamic)
+        for (uint64_t i = 0; i < num_boxes; i++) {
+            auto &box = boxes[i];
+            auto initial_state = std::vector<T>(box.lower.size());
+            for (uint64_t x = 0; x < box.lower.size(); x++) {
+                initial_state[x] = Enclosure<T>::from_bounds(box.lower[x], box.upper[x]);
+            }
+            auto solution = solve_box(initial_state);
+            record(box, solution);
+            if (fold) {
+#               pragma omp critical(box_hull)
+                fold_hull(hull_min, hull_max, solution);
+                box.folded = true;
+            }
+        }
+
+        if (fold) {
+            _discretization_size = boxes[0].lower.size();
+            _num_timesteps = _hull_min.size() / _discretization_size;
+        }
+    }
+
+    /**
+     * @return Bounds of a cell of a solution. A NaN bound carries no information, so is widened to keep the hull sound.
+     */
+    static Winterval cell_bounds(const RectangularMesh<T> &solution, uint64_t t, uint64_t x) {
+        auto bounds = Enclosure<T>::bounds(solution.get(t, x));
+        return {std::isnan(bounds.min()) ? -INFINITY : bounds.min(), std::isnan(bounds.max()) ? INFINITY : bounds.max()};
+    }
+
+    /**
+     * @brief Record the widest cell of the final row of a solution of a box.
+     */
+    static void record(Box &box, const RectangularMesh<T> &solution) {
+        auto last = solution.num_timesteps() - 1;
+        for (uint64_t x = 0; x < solution.discretization_size(); x++) {
+            auto bounds = cell_bounds(solution, last, x);
+            auto width = bounds.max() - bounds.min();
+            if (width > box.width) {
+                box.width = width;
+                box.widest_cell = x;
+            }
+        }
+    }
+
+    /**
+     * @brief Widen the running hull to contain a solution, starting it from the first.
+     */
+    static void fold_hull(std::vector<double> &hull_min, std::vector<double> &hull_max, const RectangularMesh<T> &solution) {
+        auto discretization_size = solution.discretization_size();
+        auto num_cells = discretization_size * solution.num_timesteps();
+        if (hull_min.empty()) {
+            hull_min.assign(num_cells, INFINITY);
+            hull_max.assign(num_cells, -INFINITY);
+        }
+        assert(hull_min.size() == num_cells);
+
+        for (uint64_t cell = 0; cell < num_cells; cell++) {
+            auto bounds = cell_bounds(solution, cell / discretization_size, cell % discretization_size);
+            hull_min[cell] = std::min(hull_min[cell], bounds.min());
+            hull_max[cell] = std::max(hull_max[cell], bounds.max());
+        }
+    }
+
+    /**
+     * @return The per-cell hull of the solutions of every box.
+     */
+    RectangularMesh<Winterval> hull() const {
+        auto hull = RectangularMesh<Winterval>(_discretization_size, _num_timesteps);
+        for (uint64_t cell = 0; cell < _hull_min.size(); cell++) {
+            hull.set(cell / _discretization_size, cell % _discretization_size, Winterval(_hull_min[cell], _hull_max[cell]));
+        }
+        return hull;
+    }
+};
+
+#endif //PDENCLOSE_BOXSPLITTER_H
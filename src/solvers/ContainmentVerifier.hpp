@@ -0,0 +1,210 @@
+//
+// Created by will on 12/6/25.
+//
+
+#ifndef PDENCLOSE_CONTAINMENTVERIFIER_H
+#define PDENCLOSE_CONTAINMENTVERIFIER_H
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "domains/Enclosure.hpp"
+#include "domains/Numeric.hpp"
+#include "domains/RealBatch.hpp"
+#include "meshes/RectangularMesh.hpp"
+
+/**
+ * Outcome of a containment check.
+ */
+struct ContainmentReport {
+    uint64_t num_samples = 0;
+    // Number of sampled cells, over every sample, that fell outside the enclosure.
+    uint64_t num_escapes = 0;
+
+    /*
+     * First escape, ordered by sample, then timestep, then cell. Only meaningful if there are escapes.
+     */
+    uint64_t sample = 0;
+    uint64_t timestep = 0;
+    uint64_t cell = 0;
+    double value = 0;
+    double min = 0;
+    double max = 0;
+
+    bool contained() const {
+        return num_escapes == 0;
+    }
+
+    void print() const {
+        if (contained()) {
+            std::cout << "All " << num_samples << " samples contained in enclosure." << std::endl;
+            return;
+        }
+        std::cout << num_escapes << " escapes found over " << num_samples << " samples." << std::endl;
+        std::cout << "First escape: sample " << sample << ", timestep " << timestep << ", point " << cell
+            << ": " << value << " outside [" << min << ", " << max << "]" << std::endl;
+    }
+};
+
+/**
+ * Monte Carlo check that an enclosure contains the real solutions it claims to.
+ *
+ * Point initial conditions are sampled from the box enclosed by the first row of the enclosure,
+ * solved over reals, and compared cell by cell against the enclosure.
+ * Samples are solved Lanes at a time as RealBatch, and batches are split between threads.
+ * Each batch is checked as soon as it is solved, then discarded, so memory use does not grow with the number of samples.
+ *
+ * The first two samples are the lower and upper corners of the box; the rest are uniform within it.
+ * Samples are seeded by index, so results do not depend on the number of threads.
+ *
+ * @tparam Lanes Number of samples solved at once.
+ */
+template<uint32_t Lanes = 8>
+class ContainmentVerifier {
+public:
+    using Batch = RealBatch<Lanes>;
+
+    /**
+     * @param num_samples Number of real solutions to sample, > 0.
+     * @param seed Seed for sampling.
+     * @param tolerance Relative slack allowed outside the enclosure, absorbing rounding differences between domains.
+     */
+    explicit ContainmentVerifier(uint64_t num_samples, uint64_t seed = 0, double tolerance = 1e-9):
+        _num_samples(num_samples), _seed(seed), _tolerance(tolerance) {
+        assert(num_samples > 0);
+        assert(tolerance >= 0);
+    }
+
+    /**
+     * @brief Check sampled real solutions against an enclosure.
+     *
+     * @param enclosure Enclosure to verify. Its first row is the box of initial conditions.
+     * @param solve_batch Callable solving the system from a std::vector<Batch> initial state,
+     * returning a RectangularMesh<Batch> with the dimensions of the enclosure. Called concurrently from several threads.
+     * @return The number of escapes, and the first escape found.
+     */
+    template<typename T, typename Solve>
+    requires Numeric<T>
+    ContainmentReport verify(const RectangularMesh<T> &enclosure, Solve &&solve_batch) const {
+        auto discretization_size = enclosure.discretization_size();
+        auto num_timesteps = enclosure.num_timesteps();
+        uint64_t num_cells = discretization_size * num_timesteps;
+
+        // Convert the enclosure to bounds once, rather than once per sample.
+        auto min = std::vector<double>(num_cells);
+        auto max = std::vector<double>(num_cells);
+#       pragma omp parallel for default(none) shared(enclosure, discretization_size, num_cells, min, max)
+        for (uint64_t cell = 0; cell < num_cells; cell++) {
+            auto bounds = Enclosure<T>::bounds(enclosure.get(cell / discretization_size, cell % discretization_size));
+            min[cell] = bounds.min();
+            max[cell] = bounds.max();
+        }
+
+        auto report = ContainmentReport();
+        report.num_samples = _num_samples;
+        uint64_t num_batches = (_num_samples + Lanes - 1) / Lanes;
+
+#       pragma omp parallel for default(none) shared(solve_batch, discretization_size, num_timesteps, num_batches, min, max, report) schedule(dynamic)
+        for (uint64_t batch = 0; batch < num_batches; batch++) {
+            auto solution = solve_batch(sample_batch(batch, min, max, discretization_size));
+            auto batch_report = check_batch(solution, batch, min, max);
+
+#           pragma omp critical
+            merge(report, batch_report);
+        }
+        return report;
+    }
+
+private:
+    uint64_t _num_samples;
+    uint64_t _seed;
+    double _tolerance;
+
+    /**
+     * @brief Draw the initial conditions of one batch of samples.
+     * Lanes past the last sample repeat the lower corner, and are ignored when checking.
+     */
+    std::vector<Batch> sample_batch(uint64_t batch, const std::vector<double> &min, const std::vector<double> &max,
+        uint64_t discretization_size) const {
+        auto initial_state = std::vector<Batch>(discretization_size);
+        for (uint32_t lane = 0; lane < Lanes; lane++) {
+            auto sample = batch * Lanes + lane;
+            auto seed = std::seed_seq{_seed & 0xffffffff, _seed >> 32, sample & 0xffffffff, sample >> 32};
+            auto generator = std::mt19937_64(seed);
+
+            for (uint64_t x = 0; x < discretization_size; x++) {
+                auto value = min[x];
+                if (sample == 1) {
+                    value = max[x];
+                } else if (sample > 1 && sample < _num_samples) {
+                    value = std::uniform_real_distribution<double>(min[x], max[x])(generator);
+                }
+                initial_state[x].set(lane, value);
+            }
+        }
+        return initial_state;
+    }
+
+    /**
+     * @brief Compare every cell of every sample in a solved batch against the enclosure bounds.
+     */
+    ContainmentReport check_batch(const RectangularMesh<Batch> &solution, uint64_t batch,
+        const std::vector<double> &min, const std::vector<double> &max) const {
+        auto report = ContainmentReport();
+        auto discretization_size = solution.discretization_size();
+
+        for (uint32_t lane = 0; lane < Lanes; lane++) {
+            auto sample = batch * Lanes + lane;
+            if (sample >= _num_samples) {
+                break;
+            }
+            for (uint64_t t = 0; t < solution.num_timesteps(); t++) {
+                for (uint64_t x = 0; x < discretization_size; x++) {
+                    auto cell = t * discretization_size + x;
+                    auto value = solution.get(t, x).value(lane);
+                    // NaN samples compare false, so are always escapes.
+                    auto contained = value >= min[cell] - _tolerance * (1 + std::abs(min[cell]))
+                        && value <= max[cell] + _tolerance * (1 + std::abs(max[cell]));
+                    if (contained) {
+                        continue;
+                    }
+
+                    if (report.num_escapes++ == 0) {
+                        report.sample = sample;
+                        report.timestep = t;
+                        report.cell = x;
+                        report.value = value;
+                        report.min = min[cell];
+                        report.max = max[cell];
+                    }
+                }
+            }
+        }
+        return report;
+    }
+
+    /**
+     * @brief Add the escapes of a batch to a report, keeping the earliest first escape.
+     */
+    static void merge(ContainmentReport &report, const ContainmentReport &batch_report) {
+        if (batch_report.contained()) {
+            return;
+        }
+        auto earlier = std::tie(batch_report.sample, batch_report.timestep, batch_report.cell)
+            < std::tie(report.sample, report.timestep, report.cell);
+        if (report.contained() || earlier) {
+            auto num_escapes = report.num_escapes;
+            auto num_samples = report.num_samples;
+            report = batch_report;
+            report.num_escapes = num_escapes;
+            report.num_samples = num_samples;
+        }
+        report.num_escapes += batch_report.num_escapes;
+    }
+};
+
+#endif //PDENCLOSE_CONTAINMENTVERIFIER_H
@@ -0,0 +1,134 @@
+//
+// Created by will on 12/9/25.
+//
+
+#ifndef PDENCLOSE_CONVERGENCEMONITOR_H
+#define PDENCLOSE_CONVERGENCEMONITOR_H
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+
+#include "domains/Enclosure.hpp"
+#include "domains/Numeric.hpp"
+#include "domains/Real.hpp"
+#include "meshes/RectangularMesh.hpp"
+
+/**
+ * Point at which a solution settled into a steady state or cycle.
+ */
+struct Convergence {
+    // Timestep whose state first repeated an earlier one. Later rows are copies of earlier rows.
+    uint64_t timestep;
+    // Number of timesteps in the cycle. A steady state has period 1.
+    uint64_t period;
+};
+
+/**
+ * Detects solutions which have settled into a steady state, or a cycle of a few timesteps,
+ * so that solvers may stop early rather than computing the same rows over and over.
+ *
+ * For reals, the state at a timestep has repeated if every cell is within tolerance of its value period timesteps earlier.
+ * For intervals, every cell must be exactly contained in its earlier enclosure: tolerance is ignored.
+ * Interval arithmetic is inclusion isotonic, so every later row is then contained in the row one period earlier,
+ * and filling the remaining rows with earlier rows is still sound. Any slack would break this.
+ *
+ * Affine and mixed forms are not supported, so never repeat. Containment of their interval bounds ignores their
+ * correlations, so does not carry through later steps.
+ *
+ * @tparam T Numeric type of the solution.
+ */
+template<typename T>
+requires Numeric<T>
+class ConvergenceMonitor {
+public:
+    /**
+     * Whether states of the domain can be compared soundly.
+     */
+    static constexpr bool supported = !std::is_same_v<T, AffineForm> && !std::is_same_v<T, MixedForm>;
+
+    /**
+     * @param max_period Longest cycle to detect, > 0. A steady state is a cycle of period 1.
+     * @param tolerance Relative slack allowed when comparing real states, >= 0. Ignored for enclosures.
+     */
+    explicit ConvergenceMonitor(uint64_t max_period, double tolerance = 1e-12):
+        _max_period(max_period), _tolerance(point_valued ? tolerance : 0) {
+        assert(max_period > 0);
+        assert(tolerance >= 0);
+    }
+
+    /**
+     * @brief Check whether the state at a timestep repeats an earlier state.
+     *
+     * @param solution Solution being computed. Rows up to and including timestep must be filled in.
+     * @param timestep Last timestep computed.
+     * @param time_levels Number of rows the state of the scheme spans, i.e. 2 for leapfrog.
+     * Every row of the state must repeat for the state to repeat.
+     * @return The shortest period the state repeats with, if any. Never, if the domain is not supported.
+     */
+    std::optional<uint64_t> period(const RectangularMesh<T> &solution, uint64_t timestep, uint32_t time_levels) const {
+        if constexpr (!supported) {
+            return std::nullopt;
+        }
+        for (uint64_t period = 1; period <= _max_period && period + time_levels - 1 <= timestep; period++) {
+            auto repeated = true;
+            for (uint64_t level = 0; level < time_levels && repeated; level++) {
+                repeated = row_contained(solution, timestep - level, timestep - level - period);
+            }
+            if (repeated) {
+                return period;
+            }
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Fill every row after timestep by continuing the cycle.
+     *
+     * @param solution Solution to fill.
+     * @param timestep Last timestep computed.
+     * @param period Period of the cycle, as found by period.
+     */
+    static void fill(RectangularMesh<T> &solution, uint64_t timestep, uint64_t period) {
+        assert(period > 0 && period <= timestep);
+        auto discretization_size = solution.discretization_size();
+        for (auto t = timestep + 1; t < solution.num_timesteps(); t++) {
+            auto source = solution.row(t - period);
+            auto destination = solution.row(t);
+#           pragma omp parallel for default(none) shared(source, destination, discretization_size)
+            for (uint64_t x = 0; x < discretization_size; x++) {
+                destination[x] = source[x];
+            }
+        }
+    }
+
+private:
+    // Domains whose values are single reals, which approximate rather than enclose, so may be compared with slack.
+    static constexpr bool point_valued = std::is_same_v<T, Real> || requires { T::lanes; };
+
+    uint64_t _max_period;
+    double _tolerance;
+
+    /**
+     * @return Whether every cell of one row lies within the bounds of the same cell in an earlier row.
+     * Rows which have not converged usually differ in their first few cells, so this returns early.
+     */
+    bool row_contained(const RectangularMesh<T> &solution, uint64_t timestep, uint64_t earlier) const {
+        auto row = solution.row(timestep);
+        auto earlier_row = solution.row(earlier);
+        for (uint64_t x = 0; x < solution.discretization_size(); x++) {
+            auto bounds = Enclosure<T>::bounds(row[x]);
+            auto earlier_bounds = Enclosure<T>::bounds(earlier_row[x]);
+            // NaN bounds compare false, so never converge.
+            auto contained = bounds.min() >= earlier_bounds.min() - _tolerance * (1 + std::abs(earlier_bounds.min()))
+                && bounds.max() <= earlier_bounds.max() + _tolerance * (1 + std::abs(earlier_bounds.max()));
+            if (!contained) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+#endif //PDENCLOSE_CONVERGENCEMONITOR_H
@@ -0,0 +1,142 @@
+//
+// Created by will on 12/9/25.
+//
+
+#ifndef PDENCLOSE_DIVERGENCEGUARD_H
+#define PDENCLOSE_DIVERGENCEGUARD_H
+#include <algorithm>
+#include <cassert>
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <optional>
+#include <type_traits>
+
+#include "domains/Enclosure.hpp"
+#include "domains/Numeric.hpp"
+#include "meshes/RectangularMesh.hpp"
+
+/**
+ * First cell of a solution whose enclosure blew up.
+ */
+struct Divergence {
+    uint64_t timestep;
+    uint64_t cell;
+    double min;
+    double max;
+
+    void print() const {
+        std::cout << "Diverged at timestep " << timestep << ", point " << cell << ": [" << min << ", " << max << "]" << std::endl;
+    }
+};
+
+/**
+ * Detects enclosures which have blown up, so that solvers may abort rather than solving to the final timestep.
+ * Once an enclosure diverges it rarely recovers, and affine and mixed forms only grow slower to step as their noise grows.
+ *
+ * A row diverges if any cell is wider than a threshold, or too many cells have NaN or infinite bounds.
+ * When a solver aborts, every remaining row is filled with the widest enclosure of the domain, so the solution stays sound.
+ *
+ * @tparam T Numeric type of the solution.
+ */
+template<typename T>
+requires Numeric<T>
+class DivergenceGuard {
+public:
+    /**
+     * @param max_width Widest a cell may grow, > 0, or 0 for no limit.
+     * @param max_nonfinite_cells Number of cells per row which may have NaN or infinite bounds.
+     */
+    explicit DivergenceGuard(double max_width = 0, uint64_t max_nonfinite_cells = 0):
+        _max_width(max_width), _max_nonfinite_cells(max_nonfinite_cells) {
+        assert(max_width >= 0);
+    }
+
+    /**
+     * @brief Check one row of a solution for divergence.
+     *
+     * @param solution Solution being computed.
+     * @param timestep Row to check.
+     * @return The first diverging cell of the row, if the row diverged.
+     */
+    std::optional<Divergence> check(const RectangularMesh<T> &solution, uint64_t timestep) const {
+        auto row = solution.row(timestep);
+        auto discretization_size = solution.discretization_size();
+        auto max_width = _max_width;
+
+        uint64_t first_wide = discretization_size;
+        uint64_t first_nonfinite = discretization_size;
+        uint64_t nonfinite = 0;
+#       pragma omp parallel for default(none) shared(row, discretization_size, max_width) reduction(min: first_wide, first_nonfinite) reduction(+: nonfinite)
+        for (uint64_t x = 0; x < discretization_size; x++) {
+            auto bounds = Enclosure<T>::bounds(row[x]);
+            if (!std::isfinite(bounds.min()) || !std::isfinite(bounds.max())) {
+                nonfinite++;
+                first_nonfinite = std::min(first_nonfinite, x);
+            } else if (max_width > 0 && bounds.max() - bounds.min() > max_width) {
+                first_wide = std::min(first_wide, x);
+            }
+        }
+
+        auto first = first_wide;
+        if (nonfinite > _max_nonfinite_cells) {
+            first = std::min(first, first_nonfinite);
+        }
+        if (first == discretization_size) {
+            return std::nullopt;
+        }
+        auto bounds = Enclosure<T>::bounds(row[first]);
+        return Divergence{timestep, first, bounds.min(), bounds.max()};
+    }
+
+    /**
+     * @brief Fill every row after timestep with the widest enclosure of the domain.
+     * Reals cannot enclose every value, so are filled with NaN.
+     */
+    static void fill(RectangularMesh<T> &solution, uint64_t timestep) {
+        auto unbounded = widest();
+        auto discretization_size = solution.discretization_size();
+        for (auto t = timestep + 1; t < solution.num_timesteps(); t++) {
+            auto row = solution.row(t);
+#           pragma omp parallel for default(none) shared(row, discretization_size, unbounded)
+            for (uint64_t x = 0; x < discretization_size; x++) {
+                row[x] = unbounded;
+            }
+        }
+    }
+
+    /**
+     * @return An enclosure of the domain with bounds [-inf, inf], or NaN for reals.
+     */
+    static T widest() {
+        auto unbounded = Enclosure<T>::from_bounds(-INFINITY, INFINITY);
+        if constexpr (std::is_same_v<T, Real> || requires { T::lanes; }) {
+            return unbounded;
+        } else {
+            if (is_unbounded(unbounded)) {
+                return unbounded;
+            }
+            // Affine forms are centred between their bounds, and the centre of [-inf, inf] is NaN.
+            // Instead centre the form at 0 and overflow its radius.
+            unbounded = Enclosure<T>::from_bounds(-DBL_MAX, DBL_MAX) * 2;
+            if (!is_unbounded(unbounded)) {
+                std::cerr << "Could not build an unbounded enclosure!" << std::endl;
+                exit(EXIT_FAILURE);
+            }
+            return unbounded;
+        }
+    }
+
+private:
+    double _max_width;
+    uint64_t _max_nonfinite_cells;
+
+    static bool is_unbounded(const T &value) {
+        auto bounds = Enclosure<T>::bounds(value);
+        return bounds.min() == -INFINITY && bounds.max() == INFINITY;
+    }
+};
+
+#endif //PDENCLOSE_DIVERGENCEGUARD_H
@@ -0,0 +1,133 @@
+//
+// Created by will on 12/10/25.
+//
+
+#ifndef PDENCLOSE_MESHSOLVER_H
+#define PDENCLOSE_MESHSOLVER_H
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include "domains/Numeric.hpp"
+#include "meshes/BoundaryCondition.hpp"
+#include "meshes/RectangularMesh.hpp"
+#include "solvers/ConvergenceMonitor.hpp"
+#include "solvers/DivergenceGuard.hpp"
+
+/**
+ * State and row handling shared by finite difference and finite volume solvers over a rectangular mesh:
+ * the boundary condition, ghost cells, and stopping early once the solution diverges or settles.
+ * @tparam T Numeric type being solved over.
+ */
+template<typename T>
+requires Numeric<T>
+class MeshSolver {
+public:
+    virtual ~MeshSolver() = default;
+
+    /**
+     * @param boundary Boundary condition to apply at both edges of the system. Periodic by default.
+     */
+    void set_boundary(std::shared_ptr<BoundaryCondition<T>> boundary) {
+        assert(boundary);
+        _boundary = std::move(boundary);
+    }
+
+    /**
+     * @param monitor Monitor to stop solving early with, once the solution repeats. May be null, the default, to always
+     * solve every timestep.
+     */
+    void set_convergence_monitor(std::shared_ptr<ConvergenceMonitor<T>> monitor) {
+        _monitor = std::move(monitor);
+    }
+
+    /**
+     * @return Where the last solution settled into a steady state or cycle, if it stopped early.
+     */
+    std::optional<Convergence> convergence() const {
+        return _convergence;
+    }
+
+    /**
+     * @param guard Guard to abort solving with, once the solution blows up. May be null, the default, to never abort.
+     */
+    void set_divergence_guard(std::shared_ptr<DivergenceGuard<T>> guard) {
+        _guard = std::move(guard);
+    }
+
+    /**
+     * @return Where the last solution first diverged, if it was aborted.
+     */
+    std::optional<Divergence> divergence() const {
+        return _divergence;
+    }
+
+protected:
+    std::shared_ptr<BoundaryCondition<T>> _boundary = std::make_shared<PeriodicBoundary<T>>();
+    std::shared_ptr<ConvergenceMonitor<T>> _monitor;
+    std::optional<Convergence> _convergence;
+    std::shared_ptr<DivergenceGuard<T>> _guard;
+    std::optional<Divergence> _divergence;
+
+    /**
+     * @return Number of neighbors on each side of a cell that the scheme reads. Rows are padded with this many ghost cells.
+     */
+    virtual uint32_t stencil_radius() const {
+        return 1;
+    }
+
+    /**
+     * @brief Apply the boundary condition to a row, so that it can be advanced without special-casing its edges.
+     */
+    void fill_ghost_cells(RectangularMesh<T> &solution, uint64_t timestep) const {
+        _boundary->fill(solution.row(timestep), solution.discretization_size(), solution.ghost_cells());
+    }
+
+    /**
+     * @return Number of rows the state of the scheme spans. Schemes depending on more than the previous row should override.
+     */
+    virtual uint32_t time_levels() const {
+        return 1;
+    }
+
+    /**
+     * @brief Check whether the solution has diverged or settled after a step, and if so, fill every remaining row.
+     * Should be called by solvers after computing each row; solving should stop once this returns true.
+     *
+     * @param solution Mesh being solved.
+     * @param timestep Last timestep computed.
+     * @return Whether the remaining rows have been filled.
+     */
+    bool stop_early(RectangularMesh<T> &solution, uint64_t timestep) {
+        if (_guard) {
+            _divergence = _guard->check(solution, timestep);
+            if (_divergence) {
+                DivergenceGuard<T>::fill(solution, timestep);
+                return true;
+            }
+        }
+
+        if (!_monitor || timestep + 1 == solution.num_timesteps()) {
+            return false;
+        }
+        auto period = _monitor->period(solution, timestep, time_levels());
+        if (!period) {
+            return false;
+        }
+        ConvergenceMonitor<T>::fill(solution, timestep, *period);
+        _convergence = Convergence{timestep, *period};
+        return true;
+    }
+
+    /**
+     * @brief Forget where the last solution stopped early, before starting another.
+     */
+    void reset_stop() {
+        _convergence.reset();
+        _divergence.reset();
+    }
+};
+
+#endif //PDENCLOSE_MESHSOLVER_H
@@ -4,21 +4,24 @@
 
 #ifndef PDENCLOSE_PDESOLVER_H
 #define PDENCLOSE_PDESOLVER_H
+#include <cmath>
+
 #include "domains/Numeric.hpp"
 #include "flux/FluxFunction.hpp"
 #include "meshes/RectangularMesh.hpp"
 #include "meshes/CflCheck.hpp"
+#include "meshes/MeshCheckpoint.hpp"
+#include "solvers/MeshSolver.hpp"
 
 /**
  * Interface for finite difference method solver.
  * @tparam T Numeric type being solved over.
+ * @tparam F Flux function type. Defaults to the virtual interface; concrete fluxes are called statically.
  */
-template<typename T>
-requires Numeric<T>
-class DifferenceSolver {
+template<typename T, typename F = FluxFunction<T>>
+requires Numeric<T> && Flux<F, T>
+class DifferenceSolver : public MeshSolver<T> {
 public:
-    virtual ~DifferenceSolver() = default;
-
     /**
     * @brief Given a set of initial conditions over some discretization of a 1d space, a time discretization, and a number of timesteps,
     * Approximate the values of the system at different points in time.
@@ -29,15 +32,67 @@ public:
     * @param delta_t Time discretization... i.e. how much time is passing logically for each step. Must be > 0, < INFINITY
     * @param delta_x Space discretization... i.e. how much space is passing logically for each step. Must be > 0, < INFINITY
     * @param flux Flux function to use for this approximation.
+    * @param checkpoint (Optional) checkpoint to periodically record the solution to.
     * @return a discretization of the partial differential equation system.
     */
-    virtual RectangularMesh<T> solve(
+    RectangularMesh<T> solve(
         const std::vector<T> &initial_state,
-        uint32_t discretization_size,
-        uint32_t num_timesteps,
+        uint64_t discretization_size,
+        uint64_t num_timesteps,
         double delta_t,
         double delta_x,
-        FluxFunction<T>* flux) = 0;
+        F *flux,
+        MeshCheckpoint<T> *checkpoint = nullptr) {
+        assert(delta_t > 0 && delta_t < INFINITY);
+        assert(delta_x > 0 && delta_x < INFINITY);
+
+        auto solution = RectangularMesh<T>(discretization_size, num_timesteps, this->stencil_radius());
+        solution.copy_initial_conditions(initial_state);
+        this->reset_stop();
+
+        auto timestep = prime(solution, delta_t, delta_x, flux);
+        // Primed rows are computed like any other, so are recorded and checked the same way.
+        for (uint64_t primed = 1; primed <= timestep; primed++) {
+            if (checkpoint) {
+                checkpoint->record(solution, primed, delta_t);
+            }
+            if (this->stop_early(solution, primed)) {
+                return solution;
+            }
+        }
+        advance(solution, timestep, delta_t, delta_x, flux, checkpoint);
+        return solution;
+    }
+
+    /**
+     * @brief Continue an interrupted approximation from the last state recorded in a checkpoint.
+     * The result is the same as if the approximation had never been interrupted.
+     *
+     * @param discretization_size Size of space being approximated. (num cols)
+     * @param num_timesteps Number of timesteps for the approximation. (num rows)
+     * @param delta_t Time discretization. Must match the interrupted approximation.
+     * @param delta_x Space discretization. Must match the interrupted approximation.
+     * @param flux Flux function to use for this approximation.
+     * @param checkpoint Checkpoint to restore from. Will continue to be recorded to.
+     * @return a discretization of the partial differential equation system.
+     */
+    RectangularMesh<T> resume(
+        uint64_t discretization_size,
+        uint64_t num_timesteps,
+        double delta_t,
+        double delta_x,
+        F *flux,
+        MeshCheckpoint<T> *checkpoint) {
+        assert(delta_t > 0 && delta_t < INFINITY);
+        assert(delta_x > 0 && delta_x < INFINITY);
+        assert(checkpoint);
+
+        auto solution = RectangularMesh<T>(discretization_size, num_timesteps, this->stencil_radius());
+        auto timestep = checkpoint->restore(solution, delta_t);
+        this->reset_stop();
+        advance(solution, timestep, delta_t, delta_x, flux, checkpoint);
+        return solution;
+    }
 
     /**
      * @brief Perform a CFL check over an entire solution mesh.
@@ -50,9 +105,9 @@ public:
      *
      * @return Whether the CFL check passed for the entire mesh.
      */
-    bool cfl_check_mesh(const RectangularMesh<T> &solution, FluxFunction<T> *flux, double delta_t, double delta_x) {
-        for (auto timestep = 0; timestep < solution.num_timesteps(); timestep++) {
-            for (auto point = 0; point < solution.discretization_size(); point++) {
+    bool cfl_check_mesh(const RectangularMesh<T> &solution, F *flux, double delta_t, double delta_x) {
+        for (uint64_t timestep = 0; timestep < solution.num_timesteps(); timestep++) {
+            for (uint64_t point = 0; point < solution.discretization_size(); point++) {
                 if (!cfl_check(flux, solution.get(timestep, point), delta_t, delta_x)) {
                     std::cout << "First CFL violation at timestep " << timestep << ", point " << point << std::endl;
                     return false;
@@ -62,6 +117,30 @@ public:
         std::cout << "No CFL violations found." << std::endl;
         return true;
     }
+
+protected:
+    /**
+     * @brief Fill in any rows beyond the initial conditions that the scheme needs before it can advance.
+     * By default, schemes only depend on the previous row.
+     *
+     * @param solution Mesh whose first row holds the initial conditions.
+     * @return The last timestep filled in.
+     */
+    virtual uint64_t prime(RectangularMesh<T> &, double, double, F *) {
+        return 0;
+    }
+
+    /**
+     * @brief Compute every row of the solution after timestep.
+     * Rows up to and including timestep must already be filled in.
+     * Implementations should fill the ghost cells of each row before reading it.
+     *
+     * @param solution Mesh to approximate.
+     * @param timestep Last timestep already filled in.
+     * @param checkpoint Checkpoint to record to after each step. May be null.
+     */
+    virtual void advance(RectangularMesh<T> &solution, uint64_t timestep, double delta_t, double delta_x,
+        F *flux, MeshCheckpoint<T> *checkpoint) = 0;
 };
 
 #endif //PDENCLOSE_PDESOLVER_H
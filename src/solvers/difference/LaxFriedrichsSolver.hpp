@@ -12,19 +12,47 @@
 #include "flux/FluxFunction.hpp"
 #include "DifferenceSolver.hpp"
 
-template<typename T>
-requires Numeric<T>
-class LaxFriedrichsSolver final : public DifferenceSolver<T> {
+template<typename T, typename F = FluxFunction<T>>
+requires Numeric<T> && Flux<F, T>
+class LaxFriedrichsSolver final : public DifferenceSolver<T, F> {
 public:
-    RectangularMesh<T> solve(const std::vector<T> &initial_state, uint32_t discretization_size, uint32_t num_timesteps, double delta_t, double delta_x, FluxFunction<T> *flux) override {
-        assert(delta_t > 0 && delta_t < INFINITY);
-        assert(delta_x > 0 && delta_x < INFINITY);
+    static constexpr auto name = "lax_friedrichs";
 
+    /*
+     * Stencils
+     */
+    static T lax_friedrichs_stencil(const T &u_i_plus_1, const T &u_i_minus_1, double k, F *flux) {
+        return (u_i_plus_1 + u_i_minus_1) * 0.5 - (flux->flux(u_i_plus_1) - flux->flux(u_i_minus_1)) * k;
+    }
+
+    /*
+     * Kernels
+     */
+
+    /**
+     * @brief Advance one row of a system by a single Lax-Friedrichs step.
+     * Other schemes may call this directly, i.e. to prime themselves in place.
+     *
+     * @param current Pointer to the first interior cell of the row to step from. Its ghost cells must be filled.
+     * @param next Pointer to the first interior cell of the row to write.
+     * @param discretization_size Number of interior cells in each row.
+     * @param delta_t Time discretization.
+     * @param delta_x Space discretization.
+     * @param flux Flux function of the system.
+     */
+    static void step(const T *current, T *next, int64_t discretization_size, double delta_t, double delta_x, F *flux) {
         auto k = delta_t / delta_x * 1/2;
-        auto solution = RectangularMesh<T>(discretization_size, num_timesteps);
-        solution.copy_initial_conditions(initial_state);
+#       pragma omp parallel for default(none) shared(current, next, discretization_size, k, flux) schedule(static)
+        for (int64_t x = 0; x < discretization_size; x++) {
+            next[x] = lax_friedrichs_stencil(current[x + 1], current[x - 1], k, flux);
+        }
+    }
 
-        for (auto timestep = 0; timestep < num_timesteps - 1; timestep++) {
+protected:
+    void advance(RectangularMesh<T> &solution, uint64_t timestep, double delta_t, double delta_x, F *flux, MeshCheckpoint<T> *checkpoint) override {
+        auto discretization_size = static_cast<int64_t>(solution.discretization_size());
+
+        for (; timestep < solution.num_timesteps() - 1; timestep++) {
             /*
              * Note: I considered parallelizing the outermost loop with a parallel directive,
              * then splitting the threads between this inner loop.
@@ -35,32 +63,16 @@ public:
              * Additionally, I found the performance advantage of an early fork negligible (if even present) in prelim testing.
              * My suspicion is that the additional barriers subsumed any performance gains
              */
-#           pragma omp parallel for default(none) shared(solution, discretization_size, timestep, k, flux)
-            for (auto x = 1; x < discretization_size - 1; x++) {
-                auto u_x_plus_1 = solution.get(timestep, x + 1);
-                auto u_x_minus_1 = solution.get(timestep, x - 1);
-                solution.set(timestep + 1, x, lax_friedrichs_stencil(u_x_plus_1, u_x_minus_1, k, flux));
-            }
-
-            // Currently, only support periodic boundary conditions.
-            solution.set(timestep + 1, 0, lax_friedrichs_stencil(
-                solution.get(timestep, 1),
-                solution.get(timestep, solution.discretization_size() - 1),
-                k, flux));
+            this->fill_ghost_cells(solution, timestep);
+            step(solution.row(timestep), solution.row(timestep + 1), discretization_size, delta_t, delta_x, flux);
 
-            solution.set(timestep + 1, solution.discretization_size() - 1, lax_friedrichs_stencil(
-                solution.get(timestep, 0),
-                solution.get(timestep, discretization_size - 2),
-                k, flux));
+            if (checkpoint) {
+                checkpoint->record(solution, timestep + 1, delta_t);
+            }
+            if (this->stop_early(solution, timestep + 1)) {
+                break;
+            }
         }
-        return solution;
-    }
-
-    /*
-     * Stencils
-     */
-    static T lax_friedrichs_stencil(T u_i_plus_1, T u_i_minus_1, double k, FluxFunction<T> *flux) {
-        return (u_i_plus_1 + u_i_minus_1) * 0.5 - (flux->flux(u_i_plus_1) - flux->flux(u_i_minus_1)) * k;
     }
 };
 
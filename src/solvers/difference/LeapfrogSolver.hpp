@@ -11,58 +11,76 @@
 #include "meshes/RectangularMesh.hpp"
 #include "flux/FluxFunction.hpp"
 
-template<typename T>
-requires Numeric<T>
-class LeapfrogSolver final: public DifferenceSolver<T> {
+template<typename T, typename F = FluxFunction<T>>
+requires Numeric<T> && Flux<F, T>
+class LeapfrogSolver final: public DifferenceSolver<T, F> {
 public:
-    RectangularMesh<T> solve(const std::vector<T> &initial_state, uint32_t discretization_size, uint32_t num_timesteps, double delta_t, double delta_x, FluxFunction<T>* flux) override {
-        assert(delta_t > 0 && delta_t < INFINITY);
-        assert(delta_x > 0 && delta_x < INFINITY);
-        assert(num_timesteps >= 2); // Need at least two timesteps to prime with Lax-Friedrichs.
+    static constexpr auto name = "leapfrog";
 
-        auto k = delta_t / delta_x;
-        auto solution = RectangularMesh<T>(discretization_size, num_timesteps);
-        solution.copy_initial_conditions(initial_state);
+    /*
+     * Stencils
+     */
+    static T leapfrog_stencil(const T &u_x_plus_1, const T &u_x_minus_1, const T &u_x_prev, double k, F *flux) {
+        return u_x_prev - (flux->flux(u_x_plus_1) - flux->flux(u_x_minus_1)) * k;
+    }
 
-        // Note: if omp defined, then this will also be parallelized w/ an extra fork/join.
-        auto first_row = LaxFriedrichsSolver<T>().solve(initial_state, discretization_size, 2, delta_t, delta_x, flux);
+    /*
+     * Kernels
+     */
 
-        // Copy first row of Lax-Friedrichs solution into our solution matrix.
-        for (auto x = 0; x < discretization_size; x++) {
-            solution.set(1, x, first_row.get(1, x));
+    /**
+     * @brief Advance one row of a system by a single leapfrog step.
+     *
+     * @param previous Pointer to the first interior cell of the row before current.
+     * @param current Pointer to the first interior cell of the row to step from. Its ghost cells must be filled.
+     * @param next Pointer to the first interior cell of the row to write.
+     * @param discretization_size Number of interior cells in each row.
+     * @param delta_t Time discretization.
+     * @param delta_x Space discretization.
+     * @param flux Flux function of the system.
+     */
+    static void step(const T *previous, const T *current, T *next, int64_t discretization_size, double delta_t, double delta_x, F *flux) {
+        auto k = delta_t / delta_x;
+#       pragma omp parallel for default(none) shared(previous, current, next, discretization_size, k, flux) schedule(static)
+        for (int64_t x = 0; x < discretization_size; x++) {
+            next[x] = leapfrog_stencil(current[x + 1], current[x - 1], previous[x], k, flux);
         }
+    }
 
-        for (auto timestep = 1; timestep < num_timesteps - 1; timestep++) {
-            // Note: parallelizing inner loop for same reason as Lax-Friedrichs solver -- see comment there.
-#           pragma omp parallel for default(none) shared(solution, timestep, discretization_size, k, flux)
-            for (auto x = 1; x < discretization_size - 1; x++) {
-                auto u_x_plus_1 = solution.get(timestep, x + 1);
-                auto u_x_minus_1 = solution.get(timestep, x - 1);
-                auto u_x_prev = solution.get(timestep - 1, x);
-                solution.set(timestep + 1, x, leapfrog_stencil(u_x_plus_1, u_x_minus_1, u_x_prev, k, flux));
-            }
-
-            // Currently, only support periodic boundary conditions.
-            solution.set(timestep + 1, 0, leapfrog_stencil(
-                solution.get(timestep, 1),
-                solution.get(timestep, solution.discretization_size() - 1),
-                solution.get(timestep - 1, 0),
-                k, flux));
-
-            solution.set(timestep + 1, solution.discretization_size() - 1, leapfrog_stencil(
-                solution.get(timestep, 0),
-                solution.get(timestep, discretization_size - 2),
-                solution.get(timestep - 1, discretization_size - 1),
-                k, flux));
-        }
-        return solution;
+protected:
+    /**
+     * Leapfrog steps from the previous two rows.
+     */
+    uint32_t time_levels() const override {
+        return 2;
     }
 
-    /*
-     * Stencils
+    /**
+     * @brief Prime the solution in place with a single Lax-Friedrichs step from the initial conditions.
      */
-    static T leapfrog_stencil(T u_x_plus_1, T u_x_minus_1, T u_x_prev, double k, FluxFunction<T> *flux) {
-        return u_x_prev - (flux->flux(u_x_plus_1) - flux->flux(u_x_minus_1)) * k;
+    uint64_t prime(RectangularMesh<T> &solution, double delta_t, double delta_x, F *flux) override {
+        assert(solution.num_timesteps() >= 2); // Need at least two timesteps to prime with Lax-Friedrichs.
+        this->fill_ghost_cells(solution, 0);
+        LaxFriedrichsSolver<T, F>::step(solution.row(0), solution.row(1), solution.discretization_size(), delta_t, delta_x, flux);
+        return 1;
+    }
+
+    void advance(RectangularMesh<T> &solution, uint64_t timestep, double delta_t, double delta_x, F *flux, MeshCheckpoint<T> *checkpoint) override {
+        assert(timestep >= 1); // Leapfrog depends on the two previous rows.
+        auto discretization_size = static_cast<int64_t>(solution.discretization_size());
+
+        for (; timestep < solution.num_timesteps() - 1; timestep++) {
+            // Note: parallelizing inner loop for same reason as Lax-Friedrichs solver -- see comment there.
+            this->fill_ghost_cells(solution, timestep);
+            step(solution.row(timestep - 1), solution.row(timestep), solution.row(timestep + 1), discretization_size, delta_t, delta_x, flux);
+
+            if (checkpoint) {
+                checkpoint->record(solution, timestep + 1, delta_t);
+            }
+            if (this->stop_early(solution, timestep + 1)) {
+                break;
+            }
+        }
     }
 };
 
@@ -0,0 +1,35 @@
+//
+// Created by will on 12/10/25.
+//
+
+#ifndef PDENCLOSE_SPLITLAXFRIEDRICHSSOLVER_H
+#define PDENCLOSE_SPLITLAXFRIEDRICHSSOLVER_H
+
+#include "SplitSolver.hpp"
+#include "solvers/difference/LaxFriedrichsSolver.hpp"
+
+/**
+ * Lax-Friedrichs scheme in 2d, stepping rows then columns with the 1d stencil.
+ */
+template<typename T, typename F = FluxFunction<T>>
+requires Numeric<T> && Flux<F, T>
+class SplitLaxFriedrichsSolver final: public SplitSolver<T, F> {
+public:
+    static constexpr auto name = "lax_friedrichs";
+
+protected:
+    void sweep_tile(const PlanarMesh<T> &current, PlanarMesh<T> &next, Axis axis, const Tile &tile,
+        double delta_t, double spacing, F *flux) override {
+        auto k = delta_t / spacing * 1/2;
+        auto stride = this->stride(current, axis);
+        for (auto y = tile.y_begin; y < tile.y_end; y++) {
+            auto row = current.row(y);
+            auto next_row = next.row(y);
+            for (auto x = tile.x_begin; x < tile.x_end; x++) {
+                next_row[x] = LaxFriedrichsSolver<T, F>::lax_friedrichs_stencil(row[x + stride], row[x - stride], k, flux);
+            }
+        }
+    }
+};
+
+#endif //PDENCLOSE_SPLITLAXFRIEDRICHSSOLVER_H
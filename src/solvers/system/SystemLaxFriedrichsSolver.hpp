@@ -0,0 +1,31 @@
+//
+// Created by will on 12/10/25.
+//
+
+#ifndef PDENCLOSE_SYSTEMLAXFRIEDRICHSSOLVER_H
+#define PDENCLOSE_SYSTEMLAXFRIEDRICHSSOLVER_H
+
+#include "SystemSolver.hpp"
+
+/**
+ * Lax-Friedrichs scheme for systems, in finite volume form: every interface takes the largest spectral radius
+ * of the whole row. More diffusive than the local scheme, but simpler to bound, as the viscosity is one value per step.
+ */
+template<typename T, size_t M, typename F = SystemFluxFunction<T, M>>
+requires Numeric<T> && SystemFlux<F, T, M>
+class SystemLaxFriedrichsSolver final : public SystemSolver<T, M, F> {
+public:
+    static constexpr auto name = "lax_friedrichs";
+
+protected:
+    void interface_viscosities(const T *radii, T *viscosities, int64_t discretization_size) const override {
+        // Cheap next to evaluating the flux of each cell, so left serial.
+        auto viscosity = radii[-1].abs();
+        for (int64_t x = 0; x <= discretization_size; x++) {
+            viscosity = this->larger(viscosity, radii[x].abs());
+        }
+        std::fill(viscosities, viscosities + discretization_size + 1, viscosity);
+    }
+};
+
+#endif //PDENCLOSE_SYSTEMLAXFRIEDRICHSSOLVER_H
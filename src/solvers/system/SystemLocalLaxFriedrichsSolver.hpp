@@ -0,0 +1,29 @@
+//
+// Created by will on 12/10/25.
+//
+
+#ifndef PDENCLOSE_SYSTEMLOCALLAXFRIEDRICHSSOLVER_H
+#define PDENCLOSE_SYSTEMLOCALLAXFRIEDRICHSSOLVER_H
+
+#include "SystemSolver.hpp"
+
+/**
+ * Local Lax-Friedrichs (Rusanov) scheme for systems: each interface takes the larger spectral radius of its two cells.
+ * With one component, this is the scalar local Lax-Friedrichs scheme.
+ */
+template<typename T, size_t M, typename F = SystemFluxFunction<T, M>>
+requires Numeric<T> && SystemFlux<F, T, M>
+class SystemLocalLaxFriedrichsSolver final : public SystemSolver<T, M, F> {
+public:
+    static constexpr auto name = "local_lax_friedrichs";
+
+protected:
+    void interface_viscosities(const T *radii, T *viscosities, int64_t discretization_size) const override {
+#       pragma omp parallel for default(none) shared(radii, viscosities, discretization_size) schedule(static)
+        for (int64_t x = 0; x <= discretization_size; x++) {
+            viscosities[x] = this->larger(radii[x].abs(), radii[x - 1].abs());
+        }
+    }
+};
+
+#endif //PDENCLOSE_SYSTEMLOCALLAXFRIEDRICHSSOLVER_H
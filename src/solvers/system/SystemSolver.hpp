@@ -0,0 +1,204 @@
+//
+// Created by will on 12/10/25.
+//
+
+#ifndef PDENCLOSE_SYSTEMSOLVER_H
+#define PDENCLOSE_SYSTEMSOLVER_H
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "domains/Numeric.hpp"
+#include "domains/Order.hpp"
+#include "domains/Real.hpp"
+#include "flux/SystemFluxFunction.hpp"
+#include "meshes/BoundaryCondition.hpp"
+#include "meshes/CflCheck.hpp"
+#include "meshes/SystemMesh.hpp"
+#include "solvers/volume/LocalLaxFriedrichsSolver.hpp"
+
+/**
+ * Finite volume solver for systems of conservation laws, with Lax-Friedrichs type interface fluxes:
+ * F = (f(u_L) + f(u_R)) / 2 - k / 2 * (u_R - u_L), for a viscosity k at least the spectral radius of the flux's Jacobian.
+ * Schemes differ in how widely they take k.
+ *
+ * Each step first evaluates the flux and spectral radius of every cell once, into one array per component.
+ * Then, one pass over the cells updates every component together, reading each component with unit stride.
+ *
+ * @tparam T Numeric type of each component.
+ * @tparam M Number of conserved quantities.
+ * @tparam F System flux type. Defaults to the virtual interface; concrete fluxes are called statically.
+ */
+template<typename T, size_t M, typename F = SystemFluxFunction<T, M>>
+requires Numeric<T> && SystemFlux<F, T, M>
+class SystemSolver {
+public:
+    virtual ~SystemSolver() = default;
+
+    /**
+     * @brief Approximate a system of conservation laws over a finite volume mesh.
+     *
+     * @param initial_state Initial values of each component of the system.
+     * @param width_values Width of each cell -- the mesh may be irregular.
+     * @param discretization_size Number of cells.
+     * @param num_timesteps Number of timesteps for simulation.
+     * @param delta_t Change in time at each step.
+     * @param flux Flux function of the system.
+     * @return The approximation of the system.
+     */
+    SystemMesh<T, M> solve(const std::array<std::vector<T>, M> &initial_state, const std::vector<double> &width_values,
+        uint64_t discretization_size, uint64_t num_timesteps, double delta_t, F *flux) {
+        assert(delta_t > 0 && delta_t < INFINITY);
+        assert(width_values.size() == discretization_size);
+
+        auto solution = SystemMesh<T, M>(discretization_size, num_timesteps, 1);
+        solution.copy_initial_conditions(initial_state);
+
+        auto size = static_cast<int64_t>(discretization_size);
+        // Flux and spectral radius of each cell, including a ghost cell on either side.
+        auto cell_fluxes = std::array<std::vector<T>, M>();
+        for (auto &component : cell_fluxes) {
+            component.resize(size + 2);
+        }
+        auto radii = std::vector<T>(size + 2);
+        // Viscosity of the left interface of each cell, followed by the right interface of the last cell.
+        auto viscosities = std::vector<T>(size + 1);
+
+        for (uint64_t timestep = 0; timestep < num_timesteps - 1; timestep++) {
+            for (size_t c = 0; c < M; c++) {
+                _boundary->fill(solution.component(c).row(timestep), discretization_size, solution.ghost_cells());
+            }
+            evaluate_cells(solution, timestep, flux, cell_fluxes, radii);
+            interface_viscosities(radii.data() + 1, viscosities.data(), size);
+            update_cells(solution, timestep, cell_fluxes, viscosities, width_values, delta_t);
+        }
+        return solution;
+    }
+
+    /**
+     * @param boundary Boundary condition to apply to every component at both edges of the system. Periodic by default.
+     * Reflective boundaries mirror every component, so do not reverse momentum as a wall would.
+     */
+    void set_boundary(std::shared_ptr<BoundaryCondition<T>> boundary) {
+        assert(boundary);
+        _boundary = std::move(boundary);
+    }
+
+    /**
+     * @brief Check the CFL condition over a mesh, by the spectral radius of every cell.
+     * If fails, prints out the first failing cell.
+     *
+     * @return Whether every cell passed the CFL check.
+     */
+    bool cfl_check_mesh(const SystemMesh<T, M> &solution, F *flux, double delta_t, const std::vector<double> &width_values) const {
+        assert(width_values.size() == solution.discretization_size());
+
+        for (uint64_t timestep = 0; timestep < solution.num_timesteps(); timestep++) {
+            for (uint64_t point = 0; point < solution.discretization_size(); point++) {
+                if (!cfl_check_derivative(flux->spectral_radius(solution.get(timestep, point)), delta_t, width_values[point])) {
+                    std::cout << "First CFL violation at timestep " << timestep << ", point " << point << std::endl;
+                    return false;
+                }
+            }
+        }
+        std::cout << "No CFL violations found." << std::endl;
+        return true;
+    }
+
+protected:
+    std::shared_ptr<BoundaryCondition<T>> _boundary = std::make_shared<PeriodicBoundary<T>>();
+
+    /**
+     * @brief Choose the viscosity of each interface.
+     *
+     * @param radii Spectral radius of each cell. radii[-1] and radii[discretization_size] are the ghost cells.
+     * @param viscosities Viscosity of each interface to write. viscosities[x] is the interface left of cell x.
+     * @param discretization_size Number of cells.
+     */
+    virtual void interface_viscosities(const T *radii, T *viscosities, int64_t discretization_size) const = 0;
+
+    /**
+     * @return The larger of two spectral radii. Over enclosures, encloses the larger of every pair of enclosed values.
+     */
+    static T larger(const T &left, const T &right) {
+        if constexpr (std::is_same_v<T, Real>) {
+            return std::max(left, right);
+        } else if constexpr (requires { T::max(left, right); }) {
+            // Batched domains have no total order, so they take the maximum lane by lane.
+            return T::max(left, right);
+        } else {
+            // Comparing enclosures picks one of them, which need not enclose the maximum.
+            return numeric_max(left, right);
+        }
+    }
+
+private:
+    /**
+     * @brief Evaluate the flux of every cell of a row once, scattering its components into their own arrays.
+     */
+    static void evaluate_cells(SystemMesh<T, M> &solution, uint64_t timestep, F *flux,
+        std::array<std::vector<T>, M> &cell_fluxes, std::vector<T> &radii) {
+        auto rows = std::array<const T *, M>();
+        auto fluxes = std::array<T *, M>();
+        for (size_t c = 0; c < M; c++) {
+            rows[c] = solution.component(c).row(timestep);
+            fluxes[c] = cell_fluxes[c].data() + 1;
+        }
+        auto cell_radii = radii.data() + 1;
+        auto size = static_cast<int64_t>(solution.discretization_size());
+
+#       pragma omp parallel for default(none) shared(rows, fluxes, cell_radii, size, flux) schedule(static)
+        for (int64_t x = -1; x <= size; x++) {
+            auto state = SystemState<T, M>();
+            for (size_t c = 0; c < M; c++) {
+                state[c] = rows[c][x];
+            }
+            auto evaluation = flux->flux_with_spectral_radius(state);
+            for (size_t c = 0; c < M; c++) {
+                fluxes[c][x] = std::move(evaluation.flux[c]);
+            }
+            cell_radii[x] = std::move(evaluation.spectral_radius);
+        }
+    }
+
+    /**
+     * @brief Update every component of every cell in one pass.
+     * Each interface flux is computed by both cells it borders, rather than stored, as the pass is bound by memory.
+     */
+    static void update_cells(SystemMesh<T, M> &solution, uint64_t timestep, const std::array<std::vector<T>, M> &cell_fluxes,
+        const std::vector<T> &viscosities, const std::vector<double> &width_values, double delta_t) {
+        auto rows = std::array<const T *, M>();
+        auto next_rows = std::array<T *, M>();
+        auto fluxes = std::array<const T *, M>();
+        for (size_t c = 0; c < M; c++) {
+            rows[c] = solution.component(c).row(timestep);
+            next_rows[c] = solution.component(c).row(timestep + 1);
+            fluxes[c] = cell_fluxes[c].data() + 1;
+        }
+        auto size = static_cast<int64_t>(solution.discretization_size());
+
+#       pragma omp parallel for default(none) shared(rows, next_rows, fluxes, viscosities, width_values, delta_t, size) schedule(static)
+        for (int64_t x = 0; x < size; x++) {
+            const auto &left_viscosity = viscosities[x];
+            const auto &right_viscosity = viscosities[x + 1];
+            auto k = delta_t / width_values[x];
+            for (size_t c = 0; c < M; c++) {
+                auto u = rows[c];
+                auto f = fluxes[c];
+                auto left_flux = (f[x] + f[x - 1]) * 0.5 - (u[x] - u[x - 1]) * left_viscosity * 0.5;
+                auto right_flux = (f[x + 1] + f[x]) * 0.5 - (u[x + 1] - u[x]) * right_viscosity * 0.5;
+                next_rows[c][x] = LocalLaxFriedrichsSolver<T>::finite_volume_update(u[x], left_flux, right_flux, k);
+            }
+        }
+    }
+};
+
+#endif //PDENCLOSE_SYSTEMSOLVER_H
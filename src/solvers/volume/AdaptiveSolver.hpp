@@ -0,0 +1,290 @@
+//
+// Created by will on 12/10/25.
+//
+
+#ifndef PDENCLOSE_ADAPTIVESOLVER_H
+#define PDENCLOSE_ADAPTIVESOLVER_H
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "LocalTimeSteppingSolver.hpp"
+#include "RiemannSolver.hpp"
+#include "VolumeSolver.hpp"
+#include "domains/Enclosure.hpp"
+#include "meshes/RectangularMesh.hpp"
+
+/**
+ * Features of the solution that cells are refined around.
+ * - gradient: jumps between the midpoints of neighboring cells, i.e. shocks.
+ * - width: wide enclosures, i.e. where uncertainty concentrates. Reals never refine by width.
+ */
+enum class RefinementCriterion {
+    gradient,
+    width,
+};
+
+/**
+ * Block-structured adaptive mesh refinement over another finite volume scheme.
+ *
+ * Each cell of the base grid is a block, split into 2^level equal cells, up to a maximum level.
+ * Every few timesteps, blocks are regridded: those whose cells meet the refinement criterion, and their neighbors,
+ * are refined to the maximum level, the rest are coarsened, and neighboring levels are graded to differ by at most one.
+ * The scheme then advances the refined grid as a nonuniform grid until the next regrid.
+ *
+ * Transfers between levels are conservative: blocks are coarsened to the average of their cells,
+ * and refined by copying their average into each cell, which also keeps enclosures sound.
+ *
+ * The solution holds the average of each block at each timestep, so it has the same shape as an unrefined solve.
+ * Regridding depends on the solution, so enclosures contain real solutions regridded on the same grids,
+ * not necessarily real solutions regridded on their own.
+ * Resuming from a checkpoint restarts from the block averages, so may differ from an uninterrupted solve.
+ *
+ * @tparam T Numeric type to operate over.
+ * @tparam F Flux function type.
+ */
+template<typename T, typename F = FluxFunction<T>>
+requires Numeric<T> && Flux<F, T>
+class AdaptiveSolver final: public VolumeSolver<T, F> {
+public:
+    static constexpr auto name = "amr";
+
+    /**
+     * By default, refines by gradient with a Godunov scheme.
+     */
+    AdaptiveSolver(): _scheme(std::make_shared<RiemannSolver<T, F>>()) {}
+
+    /**
+     * @param scheme Scheme to advance the refined grid with. Pair with local time stepping, so refined cells do not
+     * dictate delta_t for the whole grid.
+     */
+    void set_scheme(std::shared_ptr<VolumeSolver<T, F>> scheme) {
+        assert(scheme);
+        _scheme = std::move(scheme);
+    }
+
+    /**
+     * @param criterion Feature to refine around.
+     * @param threshold Refine blocks with a jump or width greater than this, > 0.
+     * @param max_level Blocks are split into up to 2^max_level cells.
+     * @param regrid_interval Regrid every this many timesteps, > 0.
+     */
+    void set_refinement(RefinementCriterion criterion, double threshold, uint32_t max_level, uint64_t regrid_interval) {
+        assert(threshold > 0);
+        assert(max_level < TimeLevels::max_level);
+        assert(regrid_interval > 0);
+        _criterion = criterion;
+        _threshold = threshold;
+        _max_level = max_level;
+        _regrid_interval = regrid_interval;
+    }
+
+    /**
+     * @return Level of each block at the end of the last solve.
+     */
+    const std::vector<uint32_t> &levels() const {
+        return _levels;
+    }
+
+    /**
+     * @return Most cells in the refined grid at any point of the last solve.
+     */
+    uint64_t peak_cells() const {
+        return _peak_cells;
+    }
+
+protected:
+    void advance(RectangularMesh<T> &solution, uint64_t timestep, const std::vector<double> &width_values,
+        double delta_t, F *flux, MeshCheckpoint<T> *checkpoint) override {
+        auto discretization_size = solution.discretization_size();
+        _scheme->set_boundary(this->_boundary);
+        _scheme->track_cfl(this->_track_cfl);
+
+        // Start unrefined from the last row, then refine around its features immediately.
+        _levels.assign(discretization_size, 0);
+        _offsets.resize(discretization_size + 1);
+        std::iota(_offsets.begin(), _offsets.end(), 0);
+        auto row = solution.row(timestep);
+        _values.assign(row, row + discretization_size);
+        _widths = width_values;
+        _peak_cells = 0;
+
+        while (timestep < solution.num_timesteps() - 1) {
+            regrid(width_values);
+            _peak_cells = std::max<uint64_t>(_peak_cells, _values.size());
+
+            auto steps = std::min(_regrid_interval, solution.num_timesteps() - 1 - timestep);
+            auto refined = _scheme->solve(_values, _widths, _values.size(), steps + 1, delta_t, flux);
+            if (auto violation = _scheme->cfl_violation()) {
+                this->record_cfl_violation(timestep + violation->first, block_of(violation->second));
+            }
+
+            for (uint64_t step = 1; step <= steps; step++) {
+                restrict_row(refined.row(step), solution.row(timestep + step));
+                if (checkpoint) {
+                    checkpoint->record(solution, timestep + step, delta_t);
+                }
+                if (this->stop_early(solution, timestep + step)) {
+                    return;
+                }
+            }
+
+            auto last = refined.row(steps);
+            std::copy(last, last + _values.size(), _values.begin());
+            timestep += steps;
+        }
+    }
+
+private:
+    // Blocks either side of a flagged block are refined too, so features do not outrun the refinement between regrids.
+    static constexpr uint32_t buffer = 1;
+
+    std::shared_ptr<VolumeSolver<T, F>> _scheme;
+    RefinementCriterion _criterion = RefinementCriterion::gradient;
+    double _threshold = 0.1;
+    uint32_t _max_level = 2;
+    uint64_t _regrid_interval = 4;
+
+    /*
+     * Refined grid. Block b holds cells _offsets[b] to _offsets[b + 1], each of width _widths of the block / 2^level.
+     */
+    std::vector<uint32_t> _levels;
+    std::vector<uint64_t> _offsets;
+    std::vector<T> _values;
+    std::vector<double> _widths;
+    uint64_t _peak_cells = 0;
+
+    /**
+     * @return Block holding a cell of the refined grid.
+     */
+    uint64_t block_of(uint64_t cell) const {
+        return std::upper_bound(_offsets.begin(), _offsets.end(), cell) - _offsets.begin() - 1;
+    }
+
+    /**
+     * @return Average of cells [begin, end) of equal width.
+     */
+    static T average(const T *cells, uint64_t begin, uint64_t end) {
+        if (end - begin == 1) {
+            return cells[begin];
+        }
+        auto total = cells[begin];
+        for (auto cell = begin + 1; cell < end; cell++) {
+            total = total + cells[cell];
+        }
+        return total * (1.0 / static_cast<double>(end - begin));
+    }
+
+    /**
+     * @brief Coarsen a row of the refined grid into the average of each block.
+     */
+    void restrict_row(const T *refined, T *blocks) const {
+        auto discretization_size = static_cast<int64_t>(_levels.size());
+        const auto &offsets = _offsets;
+#       pragma omp parallel for default(none) shared(refined, blocks, discretization_size, offsets)
+        for (int64_t block = 0; block < discretization_size; block++) {
+            blocks[block] = average(refined, offsets[block], offsets[block + 1]);
+        }
+    }
+
+    /**
+     * @brief Choose the level of each block from the refined grid, then transfer the grid to the new levels.
+     */
+    void regrid(const std::vector<double> &width_values) {
+        auto discretization_size = static_cast<int64_t>(_levels.size());
+        auto flagged = flag_blocks();
+
+        // Buffer each flagged block, then grade levels so neighbors differ by at most one.
+        auto levels = std::vector<uint32_t>(discretization_size, 0);
+        for (int64_t block = 0; block < discretization_size; block++) {
+            if (!flagged[block]) {
+                continue;
+            }
+            auto begin = std::max<int64_t>(0, block - buffer);
+            auto end = std::min<int64_t>(discretization_size, block + buffer + 1);
+            std::fill(levels.begin() + begin, levels.begin() + end, _max_level);
+        }
+        for (int64_t block = 1; block < discretization_size; block++) {
+            levels[block] = std::max(levels[block], levels[block - 1] - std::min(levels[block - 1], 1u));
+        }
+        for (auto block = discretization_size - 2; block >= 0; block--) {
+            levels[block] = std::max(levels[block], levels[block + 1] - std::min(levels[block + 1], 1u));
+        }
+        if (levels == _levels) {
+            return;
+        }
+
+        auto offsets = std::vector<uint64_t>(discretization_size + 1, 0);
+        for (int64_t block = 0; block < discretization_size; block++) {
+            offsets[block + 1] = offsets[block] + (uint64_t{1} << levels[block]);
+        }
+        auto values = std::vector<T>(offsets.back());
+        auto widths = std::vector<double>(offsets.back());
+
+        const auto &old_levels = _levels;
+        const auto &old_offsets = _offsets;
+        const auto *old_values = _values.data();
+#       pragma omp parallel for default(none) shared(discretization_size, levels, offsets, values, widths, old_levels, old_offsets, old_values, width_values)
+        for (int64_t block = 0; block < discretization_size; block++) {
+            auto begin = offsets[block];
+            auto end = offsets[block + 1];
+            auto width = std::ldexp(width_values[block], -static_cast<int>(levels[block]));
+            std::fill(widths.begin() + begin, widths.begin() + end, width);
+            if (levels[block] == old_levels[block]) {
+                std::copy(old_values + old_offsets[block], old_values + old_offsets[block + 1], values.begin() + begin);
+            } else {
+                std::fill(values.begin() + begin, values.begin() + end, average(old_values, old_offsets[block], old_offsets[block + 1]));
+            }
+        }
+
+        _levels = std::move(levels);
+        _offsets = std::move(offsets);
+        _values = std::move(values);
+        _widths = std::move(widths);
+    }
+
+    /**
+     * @return Whether each block meets the refinement criterion.
+     * By gradient, a block is flagged by jumps between any of its cells, or to the neighboring cell of the next block.
+     */
+    std::vector<char> flag_blocks() const {
+        auto discretization_size = static_cast<int64_t>(_levels.size());
+        auto flagged = std::vector<char>(discretization_size, 0);
+        const auto &offsets = _offsets;
+        const auto *values = _values.data();
+        auto cells = static_cast<uint64_t>(_values.size());
+        auto criterion = _criterion;
+        auto threshold = _threshold;
+
+#       pragma omp parallel for default(none) shared(discretization_size, flagged, offsets, values, cells, criterion, threshold)
+        for (int64_t block = 0; block < discretization_size; block++) {
+            auto begin = offsets[block];
+            auto end = offsets[block + 1];
+            auto greatest = 0.0;
+            if (criterion == RefinementCriterion::width) {
+                for (auto cell = begin; cell < end; cell++) {
+                    auto bounds = Enclosure<T>::bounds(values[cell]);
+                    greatest = std::max(greatest, bounds.max() - bounds.min());
+                }
+            } else {
+                auto midpoint = [values](uint64_t cell) {
+                    auto bounds = Enclosure<T>::bounds(values[cell]);
+                    return (bounds.min() + bounds.max()) / 2;
+                };
+                // The last cell of the grid has no neighbor to its right.
+                for (auto cell = begin; cell < std::min(end, cells - 1); cell++) {
+                    greatest = std::max(greatest, std::abs(midpoint(cell + 1) - midpoint(cell)));
+                }
+            }
+            flagged[block] = greatest > threshold;
+        }
+        return flagged;
+    }
+};
+
+#endif //PDENCLOSE_ADAPTIVESOLVER_H
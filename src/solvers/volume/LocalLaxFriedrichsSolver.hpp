@@ -6,62 +6,32 @@
 #define PDENCLOSE_LOCALLAXFRIEDRICHSSOLVER_H
 #include <cmath>
 
-#include "VolumeSolver.hpp"
+#include "LocalTimeSteppingSolver.hpp"
 #include "meshes/RectangularMesh.hpp"
 
-template<typename T>
-requires Numeric<T>
-class LocalLaxFriedrichsSolver final: public VolumeSolver<T> {
+template<typename T, typename F = FluxFunction<T>>
+requires Numeric<T> && Flux<F, T>
+class LocalLaxFriedrichsSolver final: public LocalTimeSteppingSolver<T, F> {
 public:
-    RectangularMesh<T> solve(const std::vector<T> &initial_state, const std::vector<double> &width_values, uint32_t discretization_size,
-                                    uint32_t num_timesteps, double delta_t, FluxFunction<T> *flux) override {
-        assert(delta_t > 0 && delta_t < INFINITY);
-        // Each point in the discretization must have a corresponding delta_x
-        assert(width_values.size() == discretization_size);
-        for (auto width_value : width_values) {
-            // Verify delta_x for each width.
-            assert(width_value > 0 && width_value < INFINITY);
-        }
-
-        auto solution = RectangularMesh<T>(discretization_size, num_timesteps);
-        solution.copy_initial_conditions(initial_state);
-
-        for (auto timestep = 0; timestep < num_timesteps - 1; timestep++) {
-            for (auto x = 1; x < discretization_size - 1; x++) {
-                auto u_x_plus_1 = solution.get(timestep, x + 1);
-                auto u_x_minus_1 = solution.get(timestep, x - 1);
-
-                auto k = viscosity_coefficient(u_x_plus_1, u_x_minus_1, flux) * 1/2;
-                solution.set(timestep + 1, x, local_lax_friedrichs_stencil(u_x_plus_1, u_x_minus_1, k, flux));
-            }
-
-            // Currently, only support periodic boundary conditions.
-            auto k_0 = viscosity_coefficient(solution.get(timestep, 1), solution.get(timestep, solution.discretization_size() - 1), flux) * 1/2;
-            solution.set(timestep + 1, 0, local_lax_friedrichs_stencil(
-                solution.get(timestep, 1),
-                solution.get(timestep, solution.discretization_size() - 1),
-                k_0, flux));
-
-            auto k_n = viscosity_coefficient(solution.get(timestep, 0), solution.get(timestep, discretization_size - 2), flux) * 1/2;
-            solution.set(timestep + 1, solution.discretization_size() - 1, local_lax_friedrichs_stencil(
-                solution.get(timestep, 0),
-                solution.get(timestep, discretization_size - 2),
-                k_n, flux));
-        }
-
-        return solution;
-    }
+    static constexpr auto name = "local_lax_friedrichs";
 
-private:
+    /*
+     * Stencils. Public, so that higher order schemes may apply them to reconstructed states.
+     */
 
     /*
      * In general, the viscosity of a cell is defined by the eigenvalues of the flux's Jacobian at the left and right states.
      * However, since we have a 1D system, this reduces to the absolute values of the derivatives at the left and right states.
      */
-    static T viscosity_coefficient(T u_i_plus_1, T u_i_minus_1, FluxFunction<T> *flux) {
-        auto right_propagation = flux->derivative_flux(u_i_plus_1).abs();
-        auto left_propagation = flux->derivative_flux(u_i_minus_1).abs();
-        return std::max(right_propagation, left_propagation);
+    static T viscosity_coefficient(const FluxEvaluation<T> &right, const FluxEvaluation<T> &left) {
+        auto right_propagation = right.derivative.abs();
+        auto left_propagation = left.derivative.abs();
+        // Batched domains have no total order, so they take the maximum lane by lane.
+        if constexpr (requires { T::max(right_propagation, left_propagation); }) {
+            return T::max(right_propagation, left_propagation);
+        } else {
+            return std::max(right_propagation, left_propagation);
+        }
     }
 
     // LLF stencil derived from: https://epubs.siam.org/doi/epdf/10.1137/0909030
@@ -69,8 +39,67 @@ private:
     // The application in the 1d case is clearer in https://www.martin-schreiber.info/data/webdata/phd_thesis_html/schreiber14dissertationse12.html
     // See section 2.10.1 for example with Jacobians more clearly marked. Since they consider 2d, we can replace 1d case with scalar derivative.
     // Rusanov
-    static T local_lax_friedrichs_stencil(T u_i_plus_1, T u_i_minus_1, T k, FluxFunction<T> *flux) {
-        return (flux->flux(u_i_plus_1) + flux->flux(u_i_minus_1)) * 0.5 - (u_i_plus_1 - u_i_minus_1) * k * 0.5;
+    static T local_lax_friedrichs_flux(const T &u_left, const T &u_right, const FluxEvaluation<T> &left, const FluxEvaluation<T> &right) {
+        auto k = viscosity_coefficient(right, left);
+        return (right.flux + left.flux) * 0.5 - (u_right - u_left) * k * 0.5;
+    }
+
+    /*
+     * Conservative update of a control volume: the change in its average is the net flux through its two interfaces,
+     * scaled by its own width. So, narrow cells respond faster, as they hold less mass.
+     */
+    static T finite_volume_update(const T &u, const T &left_flux, const T &right_flux, double k) {
+        return u - (right_flux - left_flux) * k;
+    }
+
+protected:
+    // Each cell is evaluated once per interface, as only some interfaces step at each substep.
+    T interface_flux(const T *row, int64_t x, F *flux) const override {
+        return local_lax_friedrichs_flux(row[x - 1], row[x], flux->flux_with_derivative(row[x - 1]), flux->flux_with_derivative(row[x]));
+    }
+
+    void advance_global(RectangularMesh<T> &solution, uint64_t timestep, const std::vector<double> &width_values,
+        double delta_t, F *flux, MeshCheckpoint<T> *checkpoint) override {
+        auto discretization_size = static_cast<int64_t>(solution.discretization_size());
+        // Flux and derivative of each cell, offset by one to include the ghost cell on either side.
+        auto evaluations = std::vector<FluxEvaluation<T>>(discretization_size + 2);
+        // Flux through the left interface of each cell, followed by the right interface of the last cell.
+        auto interface_fluxes = std::vector<T>(discretization_size + 1);
+
+        for (; timestep < solution.num_timesteps() - 1; timestep++) {
+            this->fill_ghost_cells(solution, timestep);
+            auto current = solution.row(timestep);
+            auto next = solution.row(timestep + 1);
+
+            // Each cell is evaluated once, then shared between its two interfaces.
+            this->evaluate_row(solution, timestep, width_values, delta_t, flux, evaluations);
+
+            // Note: parallelizing inner loops for same reason as Lax-Friedrichs solver -- see comment there.
+#           pragma omp parallel for default(none) shared(current, evaluations, interface_fluxes, discretization_size)
+            for (int64_t x = 0; x <= discretization_size; x++) {
+                interface_fluxes[x] = local_lax_friedrichs_flux(current[x - 1], current[x], evaluations[x], evaluations[x + 1]);
+            }
+
+#           pragma omp parallel for default(none) shared(current, next, interface_fluxes, discretization_size, width_values, delta_t) schedule(static)
+            for (int64_t x = 0; x < discretization_size; x++) {
+                next[x] = finite_volume_update(current[x], interface_fluxes[x], interface_fluxes[x + 1], delta_t / width_values[x]);
+            }
+
+            if (checkpoint) {
+                checkpoint->record(solution, timestep + 1, delta_t);
+            }
+            if (this->stop_early(solution, timestep + 1)) {
+                // Later rows are filled rather than computed, so only the last row computed is left to check.
+                timestep++;
+                break;
+            }
+        }
+
+        // The last row computed is never advanced from, so is only evaluated to check it.
+        if (this->_track_cfl) {
+            this->fill_ghost_cells(solution, timestep);
+            this->evaluate_row(solution, timestep, width_values, delta_t, flux, evaluations);
+        }
     }
 };
 
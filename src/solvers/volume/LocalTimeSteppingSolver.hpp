@@ -0,0 +1,299 @@
+//
+// Created by will on 12/10/25.
+//
+
+#ifndef PDENCLOSE_LOCALTIMESTEPPINGSOLVER_H
+#define PDENCLOSE_LOCALTIMESTEPPINGSOLVER_H
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "VolumeSolver.hpp"
+#include "meshes/RectangularMesh.hpp"
+
+/**
+ * Time level of each cell of a nonuniform grid, for local time stepping.
+ *
+ * A cell at level l is stepped 2^l times per timestep, so its step shrinks with its width:
+ * the widest cells are at level 0, cells up to twice as narrow at level 1, up to four times as narrow at level 2, etc.
+ * So, every cell satisfies the CFL condition whenever the widest cells do at the full timestep.
+ *
+ * Each interface is stepped at the finer level of its two cells.
+ * Interfaces at the edges of the system are stepped at the finest level, so both edges of a periodic system agree.
+ */
+class TimeLevels {
+public:
+    // Keeps the number of substeps representable.
+    static constexpr uint32_t max_level = 32;
+
+    /**
+     * @param width_values Width of each control volume cell.
+     */
+    explicit TimeLevels(const std::vector<double> &width_values) {
+        assert(!width_values.empty());
+        auto widest = *std::max_element(width_values.begin(), width_values.end());
+
+        _cell_levels.resize(width_values.size());
+        _step_widths.resize(width_values.size());
+        for (size_t x = 0; x < width_values.size(); x++) {
+            uint32_t level = 0;
+            while (std::ldexp(width_values[x], static_cast<int>(level)) < widest) {
+                level++;
+            }
+            assert(level <= max_level);
+            _cell_levels[x] = level;
+            _finest_level = std::max(_finest_level, level);
+            _step_widths[x] = std::ldexp(width_values[x], static_cast<int>(level));
+        }
+
+        _interface_levels.resize(width_values.size() + 1);
+        _interface_levels.front() = _finest_level;
+        _interface_levels.back() = _finest_level;
+        for (size_t x = 1; x < width_values.size(); x++) {
+            _interface_levels[x] = std::max(_cell_levels[x - 1], _cell_levels[x]);
+        }
+    }
+
+    /**
+     * @return Finest level of any cell or interface.
+     */
+    uint32_t finest_level() const {
+        return _finest_level;
+    }
+
+    /**
+     * @return Number of steps of the finest level per timestep.
+     */
+    uint64_t substeps() const {
+        return uint64_t{1} << _finest_level;
+    }
+
+    uint32_t cell_level(uint64_t x) const {
+        return _cell_levels[x];
+    }
+
+    /**
+     * @param x Interface to the left of cell x, or the right edge of the system if x is the number of cells.
+     */
+    uint32_t interface_level(uint64_t x) const {
+        return _interface_levels[x];
+    }
+
+    /**
+     * @brief Width of each cell, scaled up by its number of steps per timestep. At least the widest width.
+     * A cell satisfies the CFL condition at its own step iff it does at the full timestep with this width.
+     */
+    const std::vector<double> &step_widths() const {
+        return _step_widths;
+    }
+
+    /**
+     * @param substep Substep of the finest level, from 0 to substeps().
+     * @return Coarsest level stepping at the start of the substep. Every finer level steps there too.
+     * Substeps 0 and substeps() are the edges of the timestep, where every level steps.
+     */
+    uint32_t coarsest_level_at(uint64_t substep) const {
+        if (substep % substeps() == 0) {
+            return 0;
+        }
+        return _finest_level - static_cast<uint32_t>(std::countr_zero(substep));
+    }
+
+private:
+    uint32_t _finest_level = 0;
+    std::vector<uint32_t> _cell_levels;
+    std::vector<uint32_t> _interface_levels;
+    std::vector<double> _step_widths;
+};
+
+/**
+ * First order finite volume solver, optionally stepping each cell of a nonuniform grid at a step suited to its width.
+ *
+ * By default, every cell is stepped by delta_t, so the narrowest cell dictates delta_t for the whole grid.
+ * With local time stepping, delta_t is the step of the widest cells, and narrower cells take power-of-two substeps
+ * (see TimeLevels). Each row of the solution is still one step of delta_t.
+ *
+ * Fluxes are accounted conservatively between levels (Osher and Sanders):
+ * each interface flux is computed at the step of its finer cell, and the coarser cell holds its value through its step,
+ * accumulating the flux through each of the finer steps, then applies the total once its own step ends.
+ * So, mass leaving one cell enters its neighbor exactly, and the scheme remains monotone under each cell's own CFL condition.
+ * See: https://doi.org/10.1090/S0025-5718-1983-0689477-0
+ *
+ * Implementations supply the flux through one interface.
+ *
+ * @tparam T Numeric type to operate over.
+ * @tparam F Flux function type.
+ */
+template<typename T, typename F = FluxFunction<T>>
+requires Numeric<T> && Flux<F, T>
+class LocalTimeSteppingSolver: public VolumeSolver<T, F> {
+public:
+    /**
+     * @param enabled Whether to step each cell at a step suited to its width in subsequent solves.
+     * On a uniform grid, this is the same as stepping every cell by delta_t.
+     */
+    void set_local_time_stepping(bool enabled) {
+        _local_time_stepping = enabled;
+    }
+
+protected:
+    bool _local_time_stepping = false;
+
+    /**
+     * @brief Compute the flux through the interface to the left of a cell.
+     *
+     * @param row Row to read. Its ghost cells are filled.
+     * @param x Cell to the right of the interface, up to the number of cells for the right edge of the system.
+     * @param flux Flux function to approximate system with.
+     */
+    virtual T interface_flux(const T *row, int64_t x, F *flux) const = 0;
+
+    /**
+     * @brief Prepare to compute interface fluxes with a flux function, i.e. to cache its properties.
+     * Called before advancing each solve.
+     */
+    virtual void prepare_interface_fluxes(F *) {}
+
+    /**
+     * @brief Advance every cell by delta_t at once.
+     * Same contract as advance.
+     */
+    virtual void advance_global(RectangularMesh<T> &solution, uint64_t timestep, const std::vector<double> &width_values,
+        double delta_t, F *flux, MeshCheckpoint<T> *checkpoint) = 0;
+
+    void advance(RectangularMesh<T> &solution, uint64_t timestep, const std::vector<double> &width_values,
+        double delta_t, F *flux, MeshCheckpoint<T> *checkpoint) final {
+        prepare_interface_fluxes(flux);
+        if (_local_time_stepping) {
+            advance_local(solution, timestep, width_values, delta_t, flux, checkpoint);
+        } else {
+            advance_global(solution, timestep, width_values, delta_t, flux, checkpoint);
+        }
+    }
+
+private:
+    /**
+     * @brief Advance each cell by substeps of delta_t suited to its width.
+     * With CFL tracking, each row is checked at the step of each cell. Intermediate substeps are not checked.
+     */
+    void advance_local(RectangularMesh<T> &solution, uint64_t timestep, const std::vector<double> &width_values,
+        double delta_t, F *flux, MeshCheckpoint<T> *checkpoint) {
+        auto discretization_size = static_cast<int64_t>(solution.discretization_size());
+        auto levels = TimeLevels(width_values);
+        auto finest_level = levels.finest_level();
+        const auto &step_widths = levels.step_widths();
+
+        // Interfaces and cells, finest level first. Those stepping at a substep are then a prefix of each order.
+        auto interfaces = finest_first(discretization_size + 1, finest_level, [&](int64_t x) { return levels.interface_level(x); });
+        auto cells = finest_first(discretization_size, finest_level, [&](int64_t x) { return levels.cell_level(x); });
+        // A cell accumulates flux whenever either of its interfaces steps.
+        auto touched = finest_first(discretization_size, finest_level, [&](int64_t x) {
+            return std::max(levels.interface_level(x), levels.interface_level(x + 1));
+        });
+
+        // Flux through each interface over its last step, i.e. multiplied by the step.
+        auto interface_fluxes = std::vector<T>(discretization_size + 1);
+        // Net flux out of each cell over the part of its step so far.
+        auto outflows = std::vector<T>(discretization_size);
+
+        for (; timestep < solution.num_timesteps() - 1; timestep++) {
+            if (this->_track_cfl) {
+                this->track_cfl_row(solution, timestep, step_widths, delta_t, flux);
+            }
+            // Each row starts as the last, then is stepped in place.
+            auto next = solution.row(timestep + 1);
+            const T *current = solution.row(timestep);
+#           pragma omp parallel for default(none) shared(current, next, discretization_size) schedule(static)
+            for (int64_t x = 0; x < discretization_size; x++) {
+                next[x] = current[x];
+            }
+
+            for (uint64_t substep = 0; substep < levels.substeps(); substep++) {
+                this->fill_ghost_cells(solution, timestep + 1);
+                auto coarsest = levels.coarsest_level_at(substep);
+                auto ending = levels.coarsest_level_at(substep + 1);
+
+                auto interface_order = interfaces.order.data();
+                auto stepping = static_cast<int64_t>(interfaces.prefix[coarsest]);
+#               pragma omp parallel for default(none) shared(next, interface_order, stepping, interface_fluxes, levels, delta_t, flux)
+                for (int64_t i = 0; i < stepping; i++) {
+                    auto x = interface_order[i];
+                    interface_fluxes[x] = interface_flux(next, x, flux) * std::ldexp(delta_t, -static_cast<int>(levels.interface_level(x)));
+                }
+
+                // Cells starting a step take the flux of this substep, and the rest add it to the flux of their step so far.
+                auto touched_order = touched.order.data();
+                stepping = static_cast<int64_t>(touched.prefix[coarsest]);
+#               pragma omp parallel for default(none) shared(touched_order, stepping, interface_fluxes, outflows, levels, coarsest)
+                for (int64_t i = 0; i < stepping; i++) {
+                    auto x = touched_order[i];
+                    if (levels.cell_level(x) >= coarsest) {
+                        outflows[x] = interface_fluxes[x + 1] - interface_fluxes[x];
+                        continue;
+                    }
+                    if (levels.interface_level(x) >= coarsest) {
+                        outflows[x] = outflows[x] - interface_fluxes[x];
+                    }
+                    if (levels.interface_level(x + 1) >= coarsest) {
+                        outflows[x] = outflows[x] + interface_fluxes[x + 1];
+                    }
+                }
+
+                // Cells ending a step apply the flux of the whole step.
+                auto cell_order = cells.order.data();
+                stepping = static_cast<int64_t>(cells.prefix[ending]);
+#               pragma omp parallel for default(none) shared(next, cell_order, stepping, outflows, width_values)
+                for (int64_t i = 0; i < stepping; i++) {
+                    auto x = cell_order[i];
+                    next[x] = next[x] - outflows[x] * (1 / width_values[x]);
+                }
+            }
+
+            if (checkpoint) {
+                checkpoint->record(solution, timestep + 1, delta_t);
+            }
+            if (this->stop_early(solution, timestep + 1)) {
+                // Later rows are filled rather than computed, so only the last row computed is left to check.
+                timestep++;
+                break;
+            }
+        }
+
+        // The last row computed is never advanced from, so is only checked.
+        if (this->_track_cfl) {
+            this->track_cfl_row(solution, timestep, step_widths, delta_t, flux);
+        }
+    }
+
+    /**
+     * Indices ordered from the finest level to the coarsest.
+     * prefix[l] is the number of indices at level l or finer, i.e. those stepping at a substep where level l steps.
+     */
+    struct LevelOrder {
+        std::vector<int64_t> order;
+        std::vector<uint64_t> prefix;
+    };
+
+    template<typename L>
+    static LevelOrder finest_first(int64_t size, uint32_t finest_level, L &&level) {
+        auto result = LevelOrder{std::vector<int64_t>(size), std::vector<uint64_t>(finest_level + 1)};
+        std::iota(result.order.begin(), result.order.end(), 0);
+        std::stable_sort(result.order.begin(), result.order.end(), [&](int64_t a, int64_t b) {
+            return level(a) > level(b);
+        });
+        for (int64_t x = 0; x < size; x++) {
+            result.prefix[level(x)]++;
+        }
+        // Accumulate counts from the finest level down.
+        for (auto l = static_cast<int64_t>(finest_level) - 1; l >= 0; l--) {
+            result.prefix[l] += result.prefix[l + 1];
+        }
+        return result;
+    }
+};
+
+#endif //PDENCLOSE_LOCALTIMESTEPPINGSOLVER_H
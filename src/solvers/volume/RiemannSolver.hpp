@@ -0,0 +1,200 @@
+//
+// Created by will on 12/10/25.
+//
+
+#ifndef PDENCLOSE_RIEMANNSOLVER_H
+#define PDENCLOSE_RIEMANNSOLVER_H
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "LocalLaxFriedrichsSolver.hpp"
+#include "LocalTimeSteppingSolver.hpp"
+#include "domains/Enclosure.hpp"
+#include "domains/Order.hpp"
+#include "meshes/RectangularMesh.hpp"
+
+/**
+ * Numerical fluxes solving the Riemann problem at each interface.
+ * - godunov: the flux of the exact solution at the interface. Least diffusive of all monotone fluxes.
+ * - hll: Harten, Lax, and van Leer's flux, averaging the solution between the slowest and fastest waves.
+ *   Cheaper than Godunov, and sharper than local Lax-Friedrichs when waves move in one direction.
+ */
+enum class RiemannFlux {
+    godunov,
+    hll,
+};
+
+/**
+ * First order finite volume solver, with the flux through each interface given by a Riemann solver.
+ *
+ * Local Lax-Friedrichs adds diffusion proportional to the fastest wave at each interface, so smears shocks, especially
+ * for non-convex fluxes such as Buckley-Leverett and cubic. The Godunov flux adds only what the exact solution requires.
+ *
+ * @tparam T Numeric type to operate over.
+ * @tparam F Flux function type.
+ */
+template<typename T, typename F = FluxFunction<T>>
+requires Numeric<T> && Flux<F, T>
+class RiemannSolver final: public LocalTimeSteppingSolver<T, F> {
+public:
+    static constexpr auto name = "riemann";
+
+    /**
+     * @param riemann_flux Numerical flux through each interface. Godunov by default.
+     */
+    void set_riemann_flux(RiemannFlux riemann_flux) {
+        _riemann_flux = riemann_flux;
+    }
+
+    /*
+     * Stencils
+     */
+
+    /**
+     * @brief Exact Godunov flux between two states.
+     * For reals, this is the least flux over [u_left, u_right] if u_left <= u_right, otherwise the greatest flux over
+     * [u_right, u_left]. The flux is monotone between its stationary points, so only those and the states are evaluated.
+     *
+     * The Godunov flux is nondecreasing in u_left and nonincreasing in u_right. So, the flux between two enclosures lies
+     * between the flux from their lower left and upper right bounds, and the flux from their upper left and lower right.
+     * The enclosure is exact up to rounding, but is taken by bounds, so affine forms lose their correlations.
+     *
+     * @param stationary_points Stationary points of the flux, from stationary_points.
+     */
+    static T godunov_flux(const T &u_left, const T &u_right, F *flux, const std::vector<double> &stationary_points) {
+        // Batches hold independent reals, so are solved lane by lane.
+        if constexpr (requires { T::lanes; }) {
+            auto result = T();
+            for (uint32_t lane = 0; lane < T::lanes; lane++) {
+                result.set(lane, godunov_bounds(u_left.value(lane), u_right.value(lane), flux, stationary_points).min());
+            }
+            return result;
+        } else {
+            auto left = Enclosure<T>::bounds(u_left);
+            auto right = Enclosure<T>::bounds(u_right);
+            auto lower = godunov_bounds(left.min(), right.max(), flux, stationary_points).min();
+            auto upper = godunov_bounds(left.max(), right.min(), flux, stationary_points).max();
+            return Enclosure<T>::from_bounds(lower, upper);
+        }
+    }
+
+    /**
+     * @brief HLL flux between two states, with the slowest and fastest waves estimated from the flux derivative of each.
+     * Written in central form, so it reduces to the average flux where neither state moves,
+     * and to upwinding where both waves move the same way.
+     * Over enclosures of derivatives straddling zero, the wave speeds are uncertain, and the flux is much wider than Godunov.
+     */
+    static T hll_flux(const T &u_left, const T &u_right, const FluxEvaluation<T> &left, const FluxEvaluation<T> &right) {
+        auto slowest = numeric_min(left.derivative, right.derivative);
+        auto fastest = numeric_max(left.derivative, right.derivative);
+        // Waves on either side of the interface, min(slowest, 0) and max(fastest, 0).
+        auto leftward = (slowest - slowest.abs()) * 0.5;
+        auto rightward = (fastest + fastest.abs()) * 0.5;
+        // rightward - leftward, as the spread of {0, left, right}, which is nonnegative over every domain.
+        auto spread = numeric_max(numeric_max(left.derivative.abs(), right.derivative.abs()),
+            (left.derivative - right.derivative).abs()) + hll_epsilon;
+
+        return (left.flux + right.flux) * 0.5
+            - (right.flux - left.flux) * (rightward + leftward) / spread * 0.5
+            + (u_right - u_left) * (rightward * leftward) / spread;
+    }
+
+protected:
+    T interface_flux(const T *row, int64_t x, F *flux) const override {
+        if (_riemann_flux == RiemannFlux::godunov) {
+            return godunov_flux(row[x - 1], row[x], flux, _stationary_points);
+        }
+        return hll_flux(row[x - 1], row[x], flux->flux_with_derivative(row[x - 1]), flux->flux_with_derivative(row[x]));
+    }
+
+    void prepare_interface_fluxes(F *flux) override {
+        _stationary_points = flux->stationary_points();
+    }
+
+    void advance_global(RectangularMesh<T> &solution, uint64_t timestep, const std::vector<double> &width_values,
+        double delta_t, F *flux, MeshCheckpoint<T> *checkpoint) override {
+        auto discretization_size = static_cast<int64_t>(solution.discretization_size());
+        // Flux and derivative of each cell, offset by one to include the ghost cell on either side.
+        auto evaluations = std::vector<FluxEvaluation<T>>(discretization_size + 2);
+        // Flux through the left interface of each cell, followed by the right interface of the last cell.
+        auto interface_fluxes = std::vector<T>(discretization_size + 1);
+        auto riemann_flux = _riemann_flux;
+
+        for (; timestep < solution.num_timesteps() - 1; timestep++) {
+            this->fill_ghost_cells(solution, timestep);
+            auto current = solution.row(timestep);
+            auto next = solution.row(timestep + 1);
+
+            // Godunov only needs derivatives to check the CFL condition.
+            if (riemann_flux == RiemannFlux::hll || this->_track_cfl) {
+                this->evaluate_row(solution, timestep, width_values, delta_t, flux, evaluations);
+            }
+
+#           pragma omp parallel for default(none) shared(current, evaluations, interface_fluxes, discretization_size, flux, riemann_flux)
+            for (int64_t x = 0; x <= discretization_size; x++) {
+                interface_fluxes[x] = riemann_flux == RiemannFlux::godunov
+                    ? godunov_flux(current[x - 1], current[x], flux, _stationary_points)
+                    : hll_flux(current[x - 1], current[x], evaluations[x], evaluations[x + 1]);
+            }
+
+#           pragma omp parallel for default(none) shared(current, next, interface_fluxes, discretization_size, width_values, delta_t) schedule(static)
+            for (int64_t x = 0; x < discretization_size; x++) {
+                next[x] = LocalLaxFriedrichsSolver<T, F>::finite_volume_update(
+                    current[x], interface_fluxes[x], interface_fluxes[x + 1], delta_t / width_values[x]);
+            }
+
+            if (checkpoint) {
+                checkpoint->record(solution, timestep + 1, delta_t);
+            }
+            if (this->stop_early(solution, timestep + 1)) {
+                // Later rows are filled rather than computed, so only the last row computed is left to check.
+                timestep++;
+                break;
+            }
+        }
+
+        // The last row computed is never advanced from, so is only evaluated to check it.
+        if (this->_track_cfl) {
+            this->track_cfl_row(solution, timestep, width_values, delta_t, flux);
+        }
+    }
+
+private:
+    // Keeps the HLL flux defined where neither state moves.
+    static constexpr double hll_epsilon = 1e-300;
+
+    RiemannFlux _riemann_flux = RiemannFlux::godunov;
+    // Stationary points of the flux being solved.
+    std::vector<double> _stationary_points;
+
+    /**
+     * @brief Godunov flux between two real states.
+     * The flux is evaluated over point enclosures of T, so the result is an interval bounding its rounding.
+     */
+    static Winterval godunov_bounds(double u_left, double u_right, F *flux, const std::vector<double> &stationary_points) {
+        auto evaluate = [flux](double value) {
+            return Enclosure<T>::bounds(flux->flux(Enclosure<T>::from_bounds(value, value)));
+        };
+        auto lower = std::min(u_left, u_right);
+        auto upper = std::max(u_left, u_right);
+        // Least flux over the range if the left state is smaller, otherwise greatest flux.
+        auto minimize = u_left <= u_right;
+
+        auto result = evaluate(u_left);
+        auto combine = [&result, minimize](const Winterval &value) {
+            result = minimize
+                ? Winterval(std::min(result.min(), value.min()), std::min(result.max(), value.max()))
+                : Winterval(std::max(result.min(), value.min()), std::max(result.max(), value.max()));
+        };
+        combine(evaluate(u_right));
+        for (auto point : stationary_points) {
+            if (point > lower && point < upper) {
+                combine(evaluate(point));
+            }
+        }
+        return result;
+    }
+};
+
+#endif //PDENCLOSE_RIEMANNSOLVER_H
@@ -0,0 +1,125 @@
+//
+// Created by will on 12/10/25.
+//
+
+#ifndef PDENCLOSE_RUNGEKUTTASOLVER_H
+#define PDENCLOSE_RUNGEKUTTASOLVER_H
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+#include "LocalLaxFriedrichsSolver.hpp"
+#include "VolumeSolver.hpp"
+#include "meshes/RectangularMesh.hpp"
+
+/**
+ * Finite volume solver integrating a reconstruction scheme in time with strong stability preserving Runge-Kutta.
+ *
+ * Time is integrated with SSP-RK2 or SSP-RK3 (Shu and Osher), convex combinations of forward Euler steps.
+ * So, any property of an Euler step under the CFL condition, such as no new extrema, carries over to the whole step.
+ * See: https://doi.org/10.1016/0021-9991(88)90177-5
+ *
+ * Implementations supply the flux through each interface of a stage.
+ *
+ * @tparam T Numeric type to operate over.
+ * @tparam F Flux function type.
+ */
+template<typename T, typename F = FluxFunction<T>>
+requires Numeric<T> && Flux<F, T>
+class RungeKuttaSolver: public VolumeSolver<T, F> {
+public:
+    /**
+     * @param rk_order Order of SSP Runge-Kutta integration: 2 or 3.
+     */
+    void set_rk_order(uint32_t rk_order) {
+        assert(rk_order == 2 || rk_order == 3);
+        _rk_order = rk_order;
+    }
+
+protected:
+    /**
+     * @param rk_order Default order of SSP Runge-Kutta integration, suited to the spatial order of the scheme.
+     */
+    explicit RungeKuttaSolver(uint32_t rk_order) {
+        set_rk_order(rk_order);
+    }
+
+    /**
+     * @brief Compute the flux through every interface of a stage.
+     *
+     * @param stage Stage to reconstruct. Its ghost cells are filled.
+     * @param discretization_size Number of control volume cells.
+     * @param flux Flux function to approximate system with.
+     * @param interface_fluxes Flux through each interface, from the left edge of the first cell to the right edge of the last.
+     */
+    virtual void compute_interface_fluxes(const T *stage, int64_t discretization_size, F *flux,
+        std::vector<T> &interface_fluxes) = 0;
+
+    void advance(RectangularMesh<T> &solution, uint64_t timestep, const std::vector<double> &width_values,
+        double delta_t, F *flux, MeshCheckpoint<T> *checkpoint) final {
+        auto discretization_size = static_cast<int64_t>(solution.discretization_size());
+        // Intermediate stages alternate between the rows of a scratch mesh.
+        auto stages = RectangularMesh<T>(solution.discretization_size(), 2, this->stencil_radius());
+        // Flux through the left interface of each cell, followed by the right interface of the last cell.
+        auto interface_fluxes = std::vector<T>(discretization_size + 1);
+        auto weights = stage_weights();
+
+        for (; timestep < solution.num_timesteps() - 1; timestep++) {
+            this->fill_ghost_cells(solution, timestep);
+            if (this->_track_cfl) {
+                this->track_cfl_row(solution, timestep, width_values, delta_t, flux);
+            }
+            const T *initial = solution.row(timestep);
+
+            const T *stage = initial;
+            for (size_t s = 0; s < weights.size(); s++) {
+                auto last = s + 1 == weights.size();
+                auto output = last ? solution.row(timestep + 1) : stages.row(s % 2);
+                compute_interface_fluxes(stage, discretization_size, flux, interface_fluxes);
+
+                auto weight = weights[s];
+#               pragma omp parallel for default(none) shared(initial, stage, output, interface_fluxes, discretization_size, width_values, delta_t, weight) schedule(static)
+                for (int64_t x = 0; x < discretization_size; x++) {
+                    auto euler = LocalLaxFriedrichsSolver<T, F>::finite_volume_update(
+                        stage[x], interface_fluxes[x], interface_fluxes[x + 1], delta_t / width_values[x]);
+                    output[x] = weight == 0 ? euler : initial[x] * weight + euler * (1 - weight);
+                }
+
+                if (!last) {
+                    this->fill_ghost_cells(stages, s % 2);
+                }
+                stage = output;
+            }
+
+            if (checkpoint) {
+                checkpoint->record(solution, timestep + 1, delta_t);
+            }
+            if (this->stop_early(solution, timestep + 1)) {
+                // Later rows are filled rather than computed, so only the last row computed is left to check.
+                timestep++;
+                break;
+            }
+        }
+
+        // The last row computed is never advanced from, so is only evaluated to check it.
+        if (this->_track_cfl) {
+            this->track_cfl_row(solution, timestep, width_values, delta_t, flux);
+        }
+    }
+
+private:
+    uint32_t _rk_order = 2;
+
+    /**
+     * @return Weight of the initial state in each stage of the Shu-Osher form of the integrator.
+     * Each stage is weight * u^n + (1 - weight) * (u + delta_t * L(u)), where u is the previous stage.
+     */
+    std::vector<double> stage_weights() const {
+        if (_rk_order == 3) {
+            return {0, 3.0 / 4, 1.0 / 3};
+        }
+        return {0, 1.0 / 2};
+    }
+};
+
+#endif //PDENCLOSE_RUNGEKUTTASOLVER_H
@@ -4,20 +4,27 @@
 
 #ifndef PDENCLOSE_VOLUMESOLVER_H
 #define PDENCLOSE_VOLUMESOLVER_H
+#include <cmath>
+#include <iostream>
+#include <optional>
+#include <utility>
+
 #include "domains/Numeric.hpp"
 #include "flux/FluxFunction.hpp"
 #include "meshes/RectangularMesh.hpp"
+#include "meshes/CflCheck.hpp"
+#include "meshes/MeshCheckpoint.hpp"
+#include "solvers/MeshSolver.hpp"
 
 /**
  * Interface for finite volume method solver.
  * @tparam T Numeric type to operate over.
+ * @tparam F Flux function type. Defaults to the virtual interface; concrete fluxes are called statically.
  */
-template<typename T>
-requires Numeric<T>
-class VolumeSolver {
+template<typename T, typename F = FluxFunction<T>>
+requires Numeric<T> && Flux<F, T>
+class VolumeSolver : public MeshSolver<T> {
 public:
-    virtual ~VolumeSolver() = default;
-
     /**
      * @brief Approximate a finite volume mesh of a discretized system with a finite volume solver.
      * The mesh may be irregular, so the discretization constant is calculated for each control volume cell.
@@ -29,15 +36,57 @@ public:
      * @param num_timesteps Number of timesteps for simulation.
      * @param delta_t Change in time at each point.
      * @param flux Flux function to approximate system with.
+     * @param checkpoint (Optional) checkpoint to periodically record the solution to.
      * @return The approximation of the system.
      */
-    virtual RectangularMesh<T> solve(
+    RectangularMesh<T> solve(
         const std::vector<T> &initial_state,
         const std::vector<double> &width_values,
-        uint32_t discretization_size,
-        uint32_t num_timesteps,
+        uint64_t discretization_size,
+        uint64_t num_timesteps,
         double delta_t,
-        FluxFunction<T>* flux) = 0;
+        F *flux,
+        MeshCheckpoint<T> *checkpoint = nullptr) {
+        assert(delta_t > 0 && delta_t < INFINITY);
+        check_widths(width_values, discretization_size);
+
+        auto solution = RectangularMesh<T>(discretization_size, num_timesteps, this->stencil_radius());
+        solution.copy_initial_conditions(initial_state);
+        _cfl_violation.reset();
+        this->reset_stop();
+        advance(solution, 0, width_values, delta_t, flux, checkpoint);
+        return solution;
+    }
+
+    /**
+     * @brief Continue an interrupted approximation from the last state recorded in a checkpoint.
+     *
+     * @param width_values Width for each point in the system. Must match the interrupted approximation.
+     * @param discretization_size Number of control volume cells.
+     * @param num_timesteps Number of timesteps for simulation.
+     * @param delta_t Change in time at each point. Must match the interrupted approximation.
+     * @param flux Flux function to approximate system with.
+     * @param checkpoint Checkpoint to restore from. Will continue to be recorded to.
+     * @return The approximation of the system.
+     */
+    RectangularMesh<T> resume(
+        const std::vector<double> &width_values,
+        uint64_t discretization_size,
+        uint64_t num_timesteps,
+        double delta_t,
+        F *flux,
+        MeshCheckpoint<T> *checkpoint) {
+        assert(delta_t > 0 && delta_t < INFINITY);
+        assert(checkpoint);
+        check_widths(width_values, discretization_size);
+
+        auto solution = RectangularMesh<T>(discretization_size, num_timesteps, this->stencil_radius());
+        auto timestep = checkpoint->restore(solution, delta_t);
+        _cfl_violation.reset();
+        this->reset_stop();
+        advance(solution, timestep, width_values, delta_t, flux, checkpoint);
+        return solution;
+    }
 
     /**
      * @brief Perform a CFL check over an entire solution mesh.
@@ -50,11 +99,11 @@ public:
      *
      * @return Whether the CFL check passed for the entire mesh.
      */
-    bool cfl_check_mesh(const RectangularMesh<T> &solution, FluxFunction<T> *flux, double delta_t, const std::vector<double> &width_values) {
+    bool cfl_check_mesh(const RectangularMesh<T> &solution, F *flux, double delta_t, const std::vector<double> &width_values) {
         assert(width_values.size() == solution.discretization_size());
 
-        for (auto timestep = 0; timestep < solution.num_timesteps(); timestep++) {
-            for (auto point = 0; point < solution.discretization_size(); point++) {
+        for (uint64_t timestep = 0; timestep < solution.num_timesteps(); timestep++) {
+            for (uint64_t point = 0; point < solution.discretization_size(); point++) {
                 if (!cfl_check(flux, solution.get(timestep, point), delta_t, width_values[point])) {
                     std::cout << "First CFL violation at timestep " << timestep << ", point " << point << std::endl;
                     return false;
@@ -65,6 +114,113 @@ public:
         return true;
     }
 
+    /**
+     * @brief Check the CFL condition of each cell while solving, from the flux derivatives the scheme already evaluates.
+     * This is cheaper than cfl_check_mesh, which evaluates the derivative of every cell again.
+     * Rows restored from a checkpoint are not checked.
+     *
+     * @param enabled Whether to track CFL violations in subsequent solves.
+     */
+    void track_cfl(bool enabled) {
+        _track_cfl = enabled;
+    }
+
+    /**
+     * @brief Report the CFL violations tracked during the last solve.
+     * If failed, prints out the timestep and point of the first failure.
+     *
+     * @return Whether every tracked cell passed the CFL check.
+     */
+    bool tracked_cfl_check() const {
+        assert(_track_cfl);
+        if (_cfl_violation) {
+            std::cout << "First CFL violation at timestep " << _cfl_violation->first << ", point " << _cfl_violation->second << std::endl;
+            return false;
+        }
+        std::cout << "No CFL violations found." << std::endl;
+        return true;
+    }
+
+    /**
+     * @return First timestep and point violating the CFL condition in the last solve, if tracked and violated.
+     */
+    std::optional<std::pair<uint64_t, uint64_t>> cfl_violation() const {
+        return _cfl_violation;
+    }
+
+protected:
+    bool _track_cfl = false;
+    // First timestep and point violating the CFL condition in the last solve, if tracked.
+    std::optional<std::pair<uint64_t, uint64_t>> _cfl_violation;
+
+    /**
+     * @brief Record a CFL violation, keeping the first. May be called from several threads.
+     */
+    void record_cfl_violation(uint64_t timestep, uint64_t point) {
+#       pragma omp critical
+        if (!_cfl_violation || std::make_pair(timestep, point) < *_cfl_violation) {
+            _cfl_violation = std::make_pair(timestep, point);
+        }
+    }
+
+    /**
+     * @brief Check every cell of a row against the CFL condition, recording the first violation.
+     * For schemes which do not evaluate the flux derivative at each cell themselves.
+     */
+    void track_cfl_row(const RectangularMesh<T> &solution, uint64_t timestep, const std::vector<double> &width_values,
+        double delta_t, F *flux) {
+        auto row = solution.row(timestep);
+        auto discretization_size = solution.discretization_size();
+
+#       pragma omp parallel for default(none) shared(row, discretization_size, width_values, delta_t, flux, timestep)
+        for (uint64_t x = 0; x < discretization_size; x++) {
+            if (!cfl_check(flux, row[x], delta_t, width_values[x])) {
+                record_cfl_violation(timestep, x);
+            }
+        }
+    }
+
+    /**
+     * @brief Evaluate the flux and its derivative at every cell of a row, including its ghost cells.
+     * If tracking CFL violations, also checks each cell against the CFL condition.
+     */
+    void evaluate_row(RectangularMesh<T> &solution, uint64_t timestep, const std::vector<double> &width_values,
+        double delta_t, F *flux, std::vector<FluxEvaluation<T>> &evaluations) {
+        auto discretization_size = static_cast<int64_t>(solution.discretization_size());
+        auto current = solution.row(timestep);
+
+#       pragma omp parallel for default(none) shared(current, evaluations, discretization_size, width_values, delta_t, flux, timestep)
+        for (int64_t x = -1; x <= discretization_size; x++) {
+            evaluations[x + 1] = flux->flux_with_derivative(current[x]);
+            auto interior = x >= 0 && x < discretization_size;
+            if (this->_track_cfl && interior && !cfl_check_derivative(evaluations[x + 1].derivative, delta_t, width_values[x])) {
+                this->record_cfl_violation(timestep, x);
+            }
+        }
+    }
+
+    /**
+     * @brief Compute every row of the solution after timestep.
+     * Rows up to and including timestep must already be filled in.
+     * Implementations should fill the ghost cells of each row before reading it.
+     *
+     * @param solution Mesh to approximate.
+     * @param timestep Last timestep already filled in.
+     * @param width_values Width of each control volume cell.
+     * @param checkpoint Checkpoint to record to after each step. May be null.
+     */
+    virtual void advance(RectangularMesh<T> &solution, uint64_t timestep, const std::vector<double> &width_values,
+        double delta_t, F *flux, MeshCheckpoint<T> *checkpoint) = 0;
+
+private:
+    static void check_widths(const std::vector<double> &width_values, uint64_t discretization_size) {
+        // Each point in the discretization must have a corresponding delta_x
+        assert(width_values.size() == discretization_size);
+        for (auto width_value : width_values) {
+            // Verify delta_x for each width.
+            assert(width_value > 0 && width_value < INFINITY);
+        }
+    }
 };
 
 #endif //PDENCLOSE_VOLUMESOLVER_H
\ No newline at end of file
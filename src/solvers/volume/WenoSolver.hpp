@@ -0,0 +1,189 @@
+//
+// Created by will on 12/10/25.
+//
+
+#ifndef PDENCLOSE_WENOSOLVER_H
+#define PDENCLOSE_WENOSOLVER_H
+#include <concepts>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "RungeKuttaSolver.hpp"
+#include "domains/Enclosure.hpp"
+#include "domains/Real.hpp"
+#include "meshes/RectangularMesh.hpp"
+
+/**
+ * Fifth order finite volume solver, by WENO reconstruction and SSP Runge-Kutta integration.
+ *
+ * The state on either side of each interface is reconstructed from the five cells nearest that side:
+ * WENO weighs three third order reconstructions by their smoothness, so the combination is fifth order where the
+ * solution is smooth, and falls back to the smoothest reconstruction near shocks, without oscillating.
+ * See: https://doi.org/10.1006/jcph.1996.0130
+ *
+ * The interface flux splits the flux into a right moving part f+ = (f(u) + a u) / 2 from the left state,
+ * and a left moving part f- = (f(u) - a u) / 2 from the right state, where a bounds the flux derivative of both states.
+ * This is the local Lax-Friedrichs flux between the reconstructed states.
+ *
+ * Reconstruction uses undivided differences, so on nonuniform grids the scheme is high order only where widths vary
+ * smoothly. It remains conservative on any grid.
+ *
+ * Over reals, the reconstruction runs over plain doubles, so it vectorizes.
+ *
+ * @tparam T Numeric type to operate over.
+ * @tparam F Flux function type.
+ */
+template<typename T, typename F = FluxFunction<T>>
+requires Numeric<T> && Flux<F, T>
+class WenoSolver final: public RungeKuttaSolver<T, F> {
+public:
+    static constexpr auto name = "weno5";
+
+    /**
+     * Spatial error is small enough that SSP-RK2 would dominate it, so integrated with SSP-RK3 by default.
+     */
+    WenoSolver(): RungeKuttaSolver<T, F>(3) {}
+
+    /*
+     * Stencils. Generic over the value type, so the same stencil runs over doubles and over T.
+     */
+
+    /**
+     * @brief Reconstruct the value at the right edge of the middle cell of five, biased towards the left.
+     * Right biased reconstructions at the left edge pass the cells in reverse.
+     *
+     * @return The WENO5 reconstruction of v at the interface.
+     */
+    template<typename V>
+    static V weno5(const V &v0, const V &v1, const V &v2, const V &v3, const V &v4) {
+        // Third order reconstructions from each sub-stencil.
+        auto q0 = (v0 * 2.0 - v1 * 7.0 + v2 * 11.0) * (1.0 / 6);
+        auto q1 = (v2 * 5.0 - v1 + v3 * 2.0) * (1.0 / 6);
+        auto q2 = (v2 * 2.0 + v3 * 5.0 - v4) * (1.0 / 6);
+
+        // Smoothness indicators: zero where a sub-stencil is linear, large where it crosses a discontinuity.
+        auto b0 = square(v0 - v1 * 2.0 + v2) * (13.0 / 12) + square(v0 - v1 * 4.0 + v2 * 3.0) * 0.25;
+        auto b1 = square(v1 - v2 * 2.0 + v3) * (13.0 / 12) + square(v1 - v3) * 0.25;
+        auto b2 = square(v2 - v3 * 2.0 + v4) * (13.0 / 12) + square(v2 * 3.0 - v3 * 4.0 + v4) * 0.25;
+
+        // Nonlinear weights are proportional to d_k / (epsilon + b_k)^2, for linear weights d = (1/10, 6/10, 3/10).
+        // Each weight is written as 1 / (1 + ratios of the others to it), so over enclosures it stays within [0, 1],
+        // rather than dividing two correlated sums. The middle weight is implied, as the weights sum to one.
+        auto s0 = square(b0 + weno_epsilon);
+        auto s1 = square(b1 + weno_epsilon);
+        auto s2 = square(b2 + weno_epsilon);
+        auto one = unit<V>();
+        auto w0 = one / (one + s0 / s1 * 6.0 + s0 / s2 * 3.0);
+        auto w2 = one / (one + s2 / s0 * (1.0 / 3) + s2 / s1 * 2.0);
+        return q1 + (q0 - q1) * w0 + (q2 - q1) * w2;
+    }
+
+protected:
+    // Interfaces read three cells on either side.
+    uint32_t stencil_radius() const override {
+        return 3;
+    }
+
+    void compute_interface_fluxes(const T *stage, int64_t discretization_size, F *flux,
+        std::vector<T> &interface_fluxes) override {
+        if constexpr (std::same_as<T, Real>) {
+            reconstruct(stage, discretization_size, _real_scratch);
+        } else {
+            reconstruct(stage, discretization_size, _scratch);
+        }
+
+        auto &left_states = _scratch.left_states;
+        auto &right_states = _scratch.right_states;
+#       pragma omp parallel for default(none) shared(discretization_size, flux, interface_fluxes, left_states, right_states)
+        for (int64_t x = 0; x <= discretization_size; x++) {
+            const auto &left = left_states[x];
+            const auto &right = right_states[x];
+            interface_fluxes[x] = LocalLaxFriedrichsSolver<T, F>::local_lax_friedrichs_flux(
+                left, right, flux->flux_with_derivative(left), flux->flux_with_derivative(right));
+        }
+    }
+
+private:
+    // Keeps the weights defined where a sub-stencil is constant. Jiang and Shu's choice.
+    static constexpr double weno_epsilon = 1e-6;
+
+    /**
+     * Reconstructed states on either side of each interface, from the left edge of the first cell to the right edge of
+     * the last. Kept between stages to avoid reallocating.
+     */
+    template<typename V>
+    struct Scratch {
+        // Values of a row, including its ghost cells. Only used when V differs from T.
+        std::vector<V> values;
+        std::vector<V> left_states;
+        std::vector<V> right_states;
+    };
+    Scratch<T> _scratch;
+    Scratch<double> _real_scratch;
+
+    /**
+     * @brief Reconstruct the states on either side of every interface of a stage into _scratch.
+     * Reals are reconstructed over doubles, as Real arithmetic is not inlined, then converted back.
+     */
+    template<typename V>
+    void reconstruct(const T *stage, int64_t discretization_size, Scratch<V> &scratch) {
+        scratch.left_states.resize(discretization_size + 1);
+        scratch.right_states.resize(discretization_size + 1);
+        auto left_states = scratch.left_states.data();
+        auto right_states = scratch.right_states.data();
+
+        if constexpr (std::same_as<V, T>) {
+            // The interface to the left of cell x lies between cells x - 3 .. x + 2.
+#           pragma omp parallel for default(none) shared(stage, discretization_size, left_states, right_states)
+            for (int64_t x = 0; x <= discretization_size; x++) {
+                left_states[x] = weno5(stage[x - 3], stage[x - 2], stage[x - 1], stage[x], stage[x + 1]);
+                right_states[x] = weno5(stage[x + 2], stage[x + 1], stage[x], stage[x - 1], stage[x - 2]);
+            }
+        } else {
+            scratch.values.resize(discretization_size + 6);
+            auto values = scratch.values.data() + 3;
+#           pragma omp parallel for default(none) shared(stage, discretization_size, values)
+            for (int64_t x = -3; x < discretization_size + 3; x++) {
+                values[x] = stage[x].value();
+            }
+
+#           pragma omp parallel for simd default(none) shared(discretization_size, values, left_states, right_states)
+            for (int64_t x = 0; x <= discretization_size; x++) {
+                left_states[x] = weno5(values[x - 3], values[x - 2], values[x - 1], values[x], values[x + 1]);
+                right_states[x] = weno5(values[x + 2], values[x + 1], values[x], values[x - 1], values[x - 2]);
+            }
+
+            _scratch.left_states.resize(discretization_size + 1);
+            _scratch.right_states.resize(discretization_size + 1);
+            auto &real_left_states = _scratch.left_states;
+            auto &real_right_states = _scratch.right_states;
+#           pragma omp parallel for default(none) shared(discretization_size, left_states, right_states, real_left_states, real_right_states)
+            for (int64_t x = 0; x <= discretization_size; x++) {
+                real_left_states[x] = T(left_states[x]);
+                real_right_states[x] = T(right_states[x]);
+            }
+        }
+    }
+
+    template<typename V>
+    static V square(const V &value) {
+        // Over enclosures, pow keeps squares nonnegative where a product of the same value with itself would not.
+        if constexpr (std::is_arithmetic_v<V>) {
+            return value * value;
+        } else {
+            return value.pow(2);
+        }
+    }
+
+    template<typename V>
+    static V unit() {
+        if constexpr (std::is_arithmetic_v<V>) {
+            return 1;
+        } else {
+            return Enclosure<V>::from_bounds(1, 1);
+        }
+    }
+};
+
+#endif //PDENCLOSE_WENOSOLVER_H
@@ -0,0 +1,62 @@
+//
+// Created by will on 12/8/25.
+//
+
+#include <cstdint>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include "domains/Real.hpp"
+#include "meshes/RectangularMesh.hpp"
+
+#include "Caffeine/AffineForm.hpp"
+#include "Winterval/Winterval.hpp"
+
+TEST(allocation, rows_aligned) {
+    // 3 + 2 * 1 cells of 8 bytes would not fill a cache line, so rows are padded.
+    auto mesh = RectangularMesh<Real>(3, 4, 1);
+    for (auto t = 0; t < 4; t++) {
+        auto row_start = reinterpret_cast<uintptr_t>(mesh.row(t) - mesh.ghost_cells());
+        ASSERT_EQ(row_start % cache_line_size, 0);
+    }
+    // Cell sizes which do not divide a cache line still yield aligned rows.
+    ASSERT_EQ(aligned_row_stride<Winterval>(5) * sizeof(Winterval) % cache_line_size, 0);
+    ASSERT_EQ(aligned_row_stride<char[24]>(5) * 24 % cache_line_size, 0);
+    ASSERT_EQ(aligned_row_stride<char[24]>(5), 8);
+}
+
+// Cells are constructed in place, including the ghost cells, so start as default values.
+TEST(allocation, cells_constructed) {
+    auto mesh = RectangularMesh<Real>(5, 3, 2);
+    for (auto t = 0; t < 3; t++) {
+        for (auto x = -2; x < 7; x++) {
+            ASSERT_EQ(mesh.row(t)[x].value(), 0);
+        }
+    }
+
+    // Large enough to be backed by huge pages, if enabled.
+    auto large = RectangularMesh<AffineForm>(1 << 12, 64, 1);
+    large.set(63, 4095, AffineForm(Winterval(1, 2)));
+    ASSERT_EQ(large.get(63, 4095).to_interval().min(), 1);
+    ASSERT_EQ(large.get(63, 4095).to_interval().max(), 2);
+}
+
+TEST(allocation, move) {
+    auto mesh = RectangularMesh<Real>(2, 2);
+    mesh.set(1, 1, Real(3));
+    auto moved = RectangularMesh<Real>(std::move(mesh));
+    ASSERT_EQ(moved.get(1, 1).value(), 3);
+}
+
+// Offsets are computed in 64 bits, so rows past 2^32 cells do not wrap around.
+TEST(allocation, offsets_above_32_bits) {
+    uint64_t row_stride = aligned_row_stride<Real>(uint64_t(1) << 20);
+    uint64_t timestep = (uint64_t(1) << 13) + 3;
+    ASSERT_EQ(row_stride, uint64_t(1) << 20);
+    ASSERT_EQ(cell_offset(timestep, 5, row_stride, 1), timestep * (uint64_t(1) << 20) + 6);
+    ASSERT_GT(cell_offset(timestep, 5, row_stride, 1), uint64_t(1) << 33);
+    // Left ghost cells sit just after the end of the previous row.
+    ASSERT_EQ(cell_offset(timestep, -1, row_stride, 1), timestep * row_stride);
+    ASSERT_EQ(cell_offset(timestep, -1, row_stride, 0) + 1, cell_offset(timestep, 0, row_stride, 0));
+}
@@ -0,0 +1,92 @@
+//
+// Created by will on 12/4/25.
+//
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "domains/Real.hpp"
+#include "flux/BurgersFlux.hpp"
+#include "meshes/BoundaryCondition.hpp"
+#include "meshes/RectangularMesh.hpp"
+#include "solvers/difference/LaxFriedrichsSolver.hpp"
+
+/**
+ * Fill the ghost cells of a mesh with one row of 1, 2, 3, 4 and two ghost cells per side.
+ * @return The row, including ghost cells.
+ */
+std::vector<double> filled_row(const BoundaryCondition<Real> &boundary) {
+    auto mesh = RectangularMesh<Real>(4, 1, 2);
+    mesh.copy_initial_conditions({Real(1), Real(2), Real(3), Real(4)});
+    boundary.fill(mesh.row(0), 4, 2);
+
+    auto values = std::vector<double>();
+    for (auto x = -2; x < 6; x++) {
+        values.push_back(mesh.row(0)[x].value());
+    }
+    return values;
+}
+
+TEST(boundary, ghost_cells) {
+    ASSERT_EQ(filled_row(PeriodicBoundary<Real>()), std::vector<double>({3, 4, 1, 2, 3, 4, 1, 2}));
+    ASSERT_EQ(filled_row(OutflowBoundary<Real>()), std::vector<double>({1, 1, 1, 2, 3, 4, 4, 4}));
+    ASSERT_EQ(filled_row(ReflectiveBoundary<Real>()), std::vector<double>({2, 1, 1, 2, 3, 4, 4, 3}));
+    ASSERT_EQ(filled_row(DirichletBoundary<Real>(Real(-1), Real(5))), std::vector<double>({-1, -1, 1, 2, 3, 4, 5, 5}));
+}
+
+// Ghost cells are not part of the system, so padded meshes compare and serialize like unpadded ones.
+TEST(boundary, padding_invisible) {
+    auto padded = RectangularMesh<Real>(3, 2, 2);
+    auto unpadded = RectangularMesh<Real>(3, 2);
+    for (auto t = 0; t < 2; t++) {
+        for (auto x = 0; x < 3; x++) {
+            padded.set(t, x, Real(t * 3 + x));
+            unpadded.set(t, x, Real(t * 3 + x));
+        }
+    }
+    PeriodicBoundary<Real>().fill(padded.row(0), 3, 2);
+
+    ASSERT_TRUE(padded.equals(unpadded));
+    ASSERT_EQ(padded.to_json_string(), unpadded.to_json_string());
+    ASSERT_TRUE(RectangularMesh<Real>::from_json_string(padded.to_json_string()).equals(unpadded));
+}
+
+// A constant state at rest against outflow boundaries stays at rest.
+TEST(boundary, outflow_constant) {
+    auto solver = LaxFriedrichsSolver<Real>();
+    solver.set_boundary(std::make_shared<OutflowBoundary<Real>>());
+    auto initial_conditions = std::vector<Real>(5, Real(2));
+    auto solution = solver.solve(initial_conditions, 5, 10, 0.1, 1, new BurgersFlux<Real>());
+
+    for (auto x = 0; x < 5; x++) {
+        ASSERT_EQ(solution.get(9, x).value(), 2);
+    }
+}
+
+// Reflective walls mirror each edge cell into its ghost cell.
+TEST(boundary, reflective_walls) {
+    auto solver = LaxFriedrichsSolver<Real>();
+    solver.set_boundary(std::make_shared<ReflectiveBoundary<Real>>());
+    auto initial_conditions = std::vector<Real>({Real(1), Real(2), Real(4), Real(4), Real(2), Real(1)});
+    auto solution = solver.solve(initial_conditions, 6, 2, 0.1, 1, new BurgersFlux<Real>());
+
+    // Left edge: (2 + 1) / 2 - (2 - 0.5) * 0.05
+    ASSERT_NEAR(solution.get(1, 0).value(), 1.425, 1e-12);
+    // Right edge: (1 + 2) / 2 - (0.5 - 2) * 0.05
+    ASSERT_NEAR(solution.get(1, 5).value(), 1.575, 1e-12);
+}
+
+// Dirichlet boundaries feed their values into the edges of the system.
+TEST(boundary, dirichlet_inflow) {
+    auto solver = LaxFriedrichsSolver<Real>();
+    solver.set_boundary(std::make_shared<DirichletBoundary<Real>>(Real(1), Real(0)));
+    auto initial_conditions = std::vector<Real>(4, Real(0));
+    auto solution = solver.solve(initial_conditions, 4, 2, 0.1, 1, new BurgersFlux<Real>());
+
+    // Left edge: (0 + 1) / 2 - (0 - 0.5) * 0.05
+    ASSERT_NEAR(solution.get(1, 0).value(), 0.525, 1e-12);
+    for (auto x = 1; x < 4; x++) {
+        ASSERT_EQ(solution.get(1, x).value(), 0);
+    }
+}
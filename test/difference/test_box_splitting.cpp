@@ -0,0 +1,83 @@
+//
+// Created by will on 12/5/25.
+//
+
+#include <gtest/gtest.h>
+
+#include "domains/Real.hpp"
+#include "flux/BurgersFlux.hpp"
+#include "solvers/BoxSplitter.hpp"
+#include "solvers/difference/LaxFriedrichsSolver.hpp"
+#include "Winterval/Winterval.hpp"
+
+const uint32_t num_timesteps = 6;
+const double delta_t = 0.5;
+const double delta_x = 1;
+
+std::vector<double> burgers_values() {
+    return {0.2, 0.5, 0.9, 0.6, 0.3};
+}
+
+RectangularMesh<Winterval> split_solve(uint32_t boxes, double tolerance) {
+    auto initial_conditions = std::vector<Winterval>();
+    for (auto value : burgers_values()) {
+        initial_conditions.emplace_back(value - tolerance, value + tolerance);
+    }
+    return BoxSplitter<Winterval>(boxes).solve(initial_conditions, [](const std::vector<Winterval> &initial_state) {
+        return LaxFriedrichsSolver<Winterval>().solve(initial_state, initial_state.size(), num_timesteps, delta_t, delta_x,
+            new BurgersFlux<Winterval>());
+    });
+}
+
+// A single box is just the original enclosure.
+TEST(box_splitting, single_box) {
+    auto initial_conditions = std::vector<Winterval>();
+    for (auto value : burgers_values()) {
+        initial_conditions.emplace_back(value - 0.1, value + 0.1);
+    }
+    auto direct = LaxFriedrichsSolver<Winterval>().solve(initial_conditions, 5, num_timesteps, delta_t, delta_x,
+        new BurgersFlux<Winterval>());
+
+    ASSERT_TRUE(split_solve(1, 0.1).equals(direct));
+}
+
+// Splitting tightens the enclosure, without losing any real solution.
+TEST(box_splitting, tighter_and_sound) {
+    auto whole = split_solve(1, 0.1);
+    auto split = split_solve(16, 0.1);
+    auto last = num_timesteps - 1;
+
+    auto whole_width = 0.0;
+    auto split_width = 0.0;
+    for (auto x = 0; x < 5; x++) {
+        ASSERT_GE(split.get(last, x).min(), whole.get(last, x).min());
+        ASSERT_LE(split.get(last, x).max(), whole.get(last, x).max());
+        whole_width += whole.get(last, x).max() - whole.get(last, x).min();
+        split_width += split.get(last, x).max() - split.get(last, x).min();
+    }
+    ASSERT_LT(split_width, whole_width);
+
+    // Corners and center of the initial box.
+    for (auto offset : {-0.1, 0.0, 0.1}) {
+        auto initial_conditions = std::vector<Real>();
+        for (auto value : burgers_values()) {
+            initial_conditions.emplace_back(value + offset);
+        }
+        auto real = LaxFriedrichsSolver<Real>().solve(initial_conditions, 5, num_timesteps, delta_t, delta_x,
+            new BurgersFlux<Real>());
+        for (uint32_t t = 0; t < num_timesteps; t++) {
+            for (auto x = 0; x < 5; x++) {
+                ASSERT_GE(real.get(t, x).value(), split.get(t, x).min() - 1e-12);
+                ASSERT_LE(real.get(t, x).value(), split.get(t, x).max() + 1e-12);
+            }
+        }
+    }
+}
+
+// Point initial conditions cannot be split further.
+TEST(box_splitting, point_box) {
+    auto split = split_solve(8, 0);
+    for (auto x = 0; x < 5; x++) {
+        ASSERT_EQ(split.get(num_timesteps - 1, x).min(), split.get(num_timesteps - 1, x).max());
+    }
+}
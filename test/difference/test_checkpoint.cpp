@@ -0,0 +1,134 @@
+//
+// Created by will on 12/2/25.
+//
+
+#include <filesystem>
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include "Caffeine/AffineForm.hpp"
+#include "domains/Real.hpp"
+#include "exe/experiment/SimulationConfig.hpp"
+#include "flux/BurgersFlux.hpp"
+#include "meshes/MeshCheckpoint.hpp"
+#include "solvers/difference/LaxFriedrichsSolver.hpp"
+#include "solvers/difference/LeapfrogSolver.hpp"
+#include "Winterval/Winterval.hpp"
+
+/**
+ * Solve a system while checkpointing, then resume from the last checkpoint.
+ * The resumed solution should be identical to the uninterrupted one.
+ */
+template<typename T>
+void assert_resume_matches(DifferenceSolver<T> *solver, const std::vector<T> &initial_conditions) {
+    uint32_t discretization_size = initial_conditions.size();
+    uint32_t num_timesteps = 12;
+    double delta_t = 0.02;
+    double delta_x = 1;
+    auto path = (std::filesystem::temp_directory_path() / "pdenclose_test_checkpoint").string();
+
+    auto checkpoint = MeshCheckpoint<T>(path, 42, 5);
+    auto solution = solver->solve(initial_conditions, discretization_size, num_timesteps, delta_t, delta_x, new BurgersFlux<T>(), &checkpoint);
+
+    auto resumed_checkpoint = MeshCheckpoint<T>(path, 42, 5);
+    auto resumed = solver->resume(discretization_size, num_timesteps, delta_t, delta_x, new BurgersFlux<T>(), &resumed_checkpoint);
+    ASSERT_TRUE(solution.equals(resumed));
+
+    std::filesystem::remove(path);
+    std::filesystem::remove(path + ".rows");
+}
+
+TEST(checkpoint, resume_real_friedrichs) {
+    auto initial_conditions = std::vector<Real>{1.0, 2.0, 3.0, 4.0};
+    assert_resume_matches<Real>(new LaxFriedrichsSolver<Real>(), initial_conditions);
+}
+
+TEST(checkpoint, resume_real_leapfrog) {
+    auto initial_conditions = std::vector<Real>{1.0, 2.0, 3.0, 4.0};
+    assert_resume_matches<Real>(new LeapfrogSolver<Real>(), initial_conditions);
+}
+
+TEST(checkpoint, resume_interval_friedrichs) {
+    auto initial_conditions = std::vector<Winterval>{Winterval(0, 1), Winterval(1, 2), Winterval(2, 3), Winterval(3, 4)};
+    assert_resume_matches<Winterval>(new LaxFriedrichsSolver<Winterval>(), initial_conditions);
+}
+
+// Within one process, resumed affine forms allocate different noise symbols than the original run.
+// So, we compare their enclosures rather than the forms themselves.
+TEST(checkpoint, resume_affine_friedrichs) {
+    uint32_t discretization_size = 4;
+    uint32_t num_timesteps = 12;
+    double delta_t = 0.02;
+    double delta_x = 1;
+    auto path = (std::filesystem::temp_directory_path() / "pdenclose_test_affine_checkpoint").string();
+
+    auto initial_conditions = std::vector<AffineForm>{
+        AffineForm(Winterval(0, 1)), AffineForm(Winterval(1, 2)), AffineForm(Winterval(2, 3)), AffineForm(Winterval(3, 4))};
+
+    auto checkpoint = MeshCheckpoint<AffineForm>(path, 42, 5);
+    auto solution = LaxFriedrichsSolver<AffineForm>().solve(initial_conditions, discretization_size, num_timesteps, delta_t, delta_x,
+        new BurgersFlux<AffineForm>(), &checkpoint);
+
+    auto resumed_checkpoint = MeshCheckpoint<AffineForm>(path, 42, 5);
+    auto resumed = LaxFriedrichsSolver<AffineForm>().resume(discretization_size, num_timesteps, delta_t, delta_x,
+        new BurgersFlux<AffineForm>(), &resumed_checkpoint);
+
+    for (uint32_t timestep = 0; timestep < num_timesteps; timestep++) {
+        for (uint32_t x = 0; x < discretization_size; x++) {
+            ASSERT_NEAR(solution.get(timestep, x).to_interval().min(), resumed.get(timestep, x).to_interval().min(), 1e-12);
+            ASSERT_NEAR(solution.get(timestep, x).to_interval().max(), resumed.get(timestep, x).to_interval().max(), 1e-12);
+        }
+    }
+
+    std::filesystem::remove(path);
+    std::filesystem::remove(path + ".rows");
+}
+
+// Missing or damaged row logs are reported rather than read past.
+TEST(checkpoint, corrupt_rows) {
+    auto path = (std::filesystem::temp_directory_path() / "pdenclose_test_corrupt_checkpoint").string();
+    auto initial_conditions = std::vector<Real>{1.0, 2.0, 3.0, 4.0};
+    auto resume = [&path]() {
+        auto checkpoint = MeshCheckpoint<Real>(path, 42, 5);
+        LaxFriedrichsSolver<Real>().resume(4, 12, 0.02, 1, new BurgersFlux<Real>(), &checkpoint);
+    };
+
+    auto checkpoint = MeshCheckpoint<Real>(path, 42, 5);
+    LaxFriedrichsSolver<Real>().solve(initial_conditions, 4, 12, 0.02, 1, new BurgersFlux<Real>(), &checkpoint);
+    auto log_bytes = std::filesystem::file_size(path + ".rows");
+
+    std::filesystem::resize_file(path + ".rows", log_bytes / 2);
+    EXPECT_EXIT(resume(), testing::ExitedWithCode(EXIT_FAILURE), "missing or truncated");
+
+    // Rows of a smaller mesh, padded out to the expected size.
+    {
+        std::ofstream f(path + ".rows", std::ios::binary | std::ios::trunc);
+        cereal::BinaryOutputArchive archive(f);
+        archive(std::vector<Real>{Real(1)});
+    }
+    std::filesystem::resize_file(path + ".rows", log_bytes);
+    EXPECT_EXIT(resume(), testing::ExitedWithCode(EXIT_FAILURE), "corrupt");
+
+    std::filesystem::remove(path + ".rows");
+    EXPECT_EXIT(resume(), testing::ExitedWithCode(EXIT_FAILURE), "missing or truncated");
+
+    std::filesystem::remove(path);
+}
+
+// Configs may describe meshes of more than 2^32 cells, and distinguish sizes differing only above 32 bits.
+TEST(checkpoint, config_above_32_bits) {
+    auto path = std::filesystem::temp_directory_path() / "pdenclose_large_config.json";
+    auto config = SimulationConfig("real", "burgers", "lax_friedrichs", (uint64_t(3) << 31), (uint64_t(1) << 33) + 1, 1, 0.01);
+    write_config(path, config);
+    auto read = read_config(path);
+    std::filesystem::remove(path);
+
+    ASSERT_EQ(read.discretization_size, uint64_t(3) << 31);
+    ASSERT_EQ(read.num_timesteps, (uint64_t(1) << 33) + 1);
+    ASSERT_EQ(config_hash(read), config_hash(config));
+
+    auto truncated = config;
+    truncated.num_timesteps = 1;
+    ASSERT_NE(config_hash(truncated), config_hash(config));
+}
@@ -0,0 +1,81 @@
+//
+// Created by will on 12/6/25.
+//
+
+#include <gtest/gtest.h>
+
+#include "domains/Real.hpp"
+#include "domains/RealBatch.hpp"
+#include "flux/BurgersFlux.hpp"
+#include "solvers/ContainmentVerifier.hpp"
+#include "solvers/difference/LaxFriedrichsSolver.hpp"
+#include "Winterval/Winterval.hpp"
+
+using Batch = ContainmentVerifier<>::Batch;
+
+const uint32_t discretization_size = 5;
+const uint32_t num_timesteps = 6;
+const double delta_t = 0.5;
+const double delta_x = 1;
+
+RectangularMesh<Batch> solve_batch(const std::vector<Batch> &initial_state) {
+    return LaxFriedrichsSolver<Batch>().solve(initial_state, discretization_size, num_timesteps, delta_t, delta_x,
+        new BurgersFlux<Batch>());
+}
+
+RectangularMesh<Winterval> burgers_enclosure() {
+    auto initial_conditions = std::vector<Winterval>();
+    for (auto value : {0.2, 0.5, 0.9, 0.6, 0.3}) {
+        initial_conditions.emplace_back(value - 0.1, value + 0.1);
+    }
+    return LaxFriedrichsSolver<Winterval>().solve(initial_conditions, discretization_size, num_timesteps, delta_t, delta_x,
+        new BurgersFlux<Winterval>());
+}
+
+// Each lane of a batch is solved exactly as a real would be.
+TEST(containment, batch_matches_real) {
+    auto initial_batch = std::vector<Batch>(discretization_size);
+    for (uint32_t x = 0; x < discretization_size; x++) {
+        for (uint32_t lane = 0; lane < Batch::lanes; lane++) {
+            initial_batch[x].set(lane, 0.1 * x + 0.05 * lane);
+        }
+    }
+    auto batch_solution = solve_batch(initial_batch);
+
+    for (uint32_t lane = 0; lane < Batch::lanes; lane++) {
+        auto initial_conditions = std::vector<Real>();
+        for (uint32_t x = 0; x < discretization_size; x++) {
+            initial_conditions.emplace_back(initial_batch[x].value(lane));
+        }
+        auto solution = LaxFriedrichsSolver<Real>().solve(initial_conditions, discretization_size, num_timesteps, delta_t,
+            delta_x, new BurgersFlux<Real>());
+        for (uint32_t t = 0; t < num_timesteps; t++) {
+            for (uint32_t x = 0; x < discretization_size; x++) {
+                ASSERT_EQ(batch_solution.get(t, x).value(lane), solution.get(t, x).value());
+            }
+        }
+    }
+}
+
+TEST(containment, interval_contained) {
+    auto report = ContainmentVerifier<>(100).verify(burgers_enclosure(), solve_batch);
+    ASSERT_TRUE(report.contained());
+    ASSERT_EQ(report.num_samples, 100);
+}
+
+// Collapse the final row of a sound enclosure to single points: the corner samples must escape.
+TEST(containment, escape_reported) {
+    auto enclosure = burgers_enclosure();
+    auto last = num_timesteps - 1;
+    for (uint32_t x = 0; x < discretization_size; x++) {
+        auto midpoint = (enclosure.get(last, x).min() + enclosure.get(last, x).max()) / 2;
+        enclosure.set(last, x, Winterval(midpoint, midpoint));
+    }
+
+    auto report = ContainmentVerifier<>(20).verify(enclosure, solve_batch);
+    ASSERT_FALSE(report.contained());
+    ASSERT_EQ(report.sample, 0);
+    ASSERT_EQ(report.timestep, last);
+    ASSERT_EQ(report.cell, 0);
+    ASSERT_EQ(report.min, report.max);
+}
@@ -0,0 +1,114 @@
+//
+// Created by will on 12/9/25.
+//
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "domains/Real.hpp"
+#include "flux/BurgersFlux.hpp"
+#include "solvers/ConvergenceMonitor.hpp"
+#include "solvers/difference/LaxFriedrichsSolver.hpp"
+#include "solvers/difference/LeapfrogSolver.hpp"
+#include "solvers/volume/LocalLaxFriedrichsSolver.hpp"
+
+#include "Winterval/Winterval.hpp"
+
+/**
+ * Lax-Friedrichs never reads a cell's own value, so alternating states swap places every step: a cycle of period 2.
+ */
+TEST(convergence, alternating_cycle) {
+    auto initial_conditions = std::vector<Real>{1, 0, 1, 0, 1, 0};
+    auto solver = LaxFriedrichsSolver<Real>();
+    auto full = solver.solve(initial_conditions, 6, 12, 0.1, 1, new BurgersFlux<Real>());
+    ASSERT_FALSE(solver.convergence());
+
+    solver.set_convergence_monitor(std::make_shared<ConvergenceMonitor<Real>>(4));
+    auto stopped = solver.solve(initial_conditions, 6, 12, 0.1, 1, new BurgersFlux<Real>());
+    ASSERT_TRUE(solver.convergence());
+    ASSERT_EQ(solver.convergence()->timestep, 2);
+    ASSERT_EQ(solver.convergence()->period, 2);
+    ASSERT_TRUE(stopped.equals(full));
+}
+
+// Without a cycle short enough to detect, every timestep is solved.
+TEST(convergence, period_too_long) {
+    auto initial_conditions = std::vector<Real>{1, 0, 1, 0, 1, 0};
+    auto solver = LaxFriedrichsSolver<Real>();
+    solver.set_convergence_monitor(std::make_shared<ConvergenceMonitor<Real>>(1));
+    solver.solve(initial_conditions, 6, 12, 0.1, 1, new BurgersFlux<Real>());
+    ASSERT_FALSE(solver.convergence());
+}
+
+// Leapfrog state spans two rows, so both must repeat.
+TEST(convergence, leapfrog_steady) {
+    auto initial_conditions = std::vector<Real>{0.5, 0.5, 0.5, 0.5};
+    auto solver = LeapfrogSolver<Real>();
+    auto full = solver.solve(initial_conditions, 4, 10, 0.1, 1, new BurgersFlux<Real>());
+
+    solver.set_convergence_monitor(std::make_shared<ConvergenceMonitor<Real>>(1));
+    auto stopped = solver.solve(initial_conditions, 4, 10, 0.1, 1, new BurgersFlux<Real>());
+    ASSERT_EQ(solver.convergence()->timestep, 2);
+    ASSERT_TRUE(stopped.equals(full));
+}
+
+TEST(convergence, volume_steady) {
+    auto initial_conditions = std::vector<Real>{0.5, 0.5, 0.5};
+    auto width_values = std::vector<double>{1, 0.5, 1};
+    auto solver = LocalLaxFriedrichsSolver<Real>();
+    solver.set_convergence_monitor(std::make_shared<ConvergenceMonitor<Real>>(1));
+    auto stopped = solver.solve(initial_conditions, width_values, 3, 10, 0.1, new BurgersFlux<Real>());
+    ASSERT_EQ(solver.convergence()->timestep, 1);
+    ASSERT_EQ(stopped.get(9, 1).value(), 0.5);
+}
+
+// Enclosures repeat once they are contained in their earlier enclosures.
+TEST(convergence, enclosure_containment) {
+    auto monitor = ConvergenceMonitor<Winterval>(2);
+    auto mesh = RectangularMesh<Winterval>(2, 4);
+    mesh.set(0, 0, Winterval(0, 2));
+    mesh.set(0, 1, Winterval(1, 3));
+    mesh.set(1, 0, Winterval(0.5, 1.5));
+    mesh.set(1, 1, Winterval(1, 4));
+    ASSERT_FALSE(monitor.period(mesh, 1, 1));
+
+    mesh.set(1, 1, Winterval(1.5, 2.5));
+    ASSERT_EQ(monitor.period(mesh, 1, 1), 1);
+    // Containment is not equality: widening back to the first state does not repeat the second,
+    // but does repeat the first, two steps earlier.
+    mesh.set(2, 0, Winterval(0, 2));
+    mesh.set(2, 1, Winterval(1, 3));
+    ASSERT_EQ(monitor.period(mesh, 2, 1), 2);
+
+    ConvergenceMonitor<Winterval>::fill(mesh, 2, 2);
+    ASSERT_EQ(mesh.get(3, 1).min(), 1.5);
+    ASSERT_EQ(mesh.get(3, 1).max(), 2.5);
+}
+
+// Slack would let an enclosure escape its earlier enclosure, so only reals are compared with tolerance.
+TEST(convergence, tolerance_reals_only) {
+    auto interval_monitor = ConvergenceMonitor<Winterval>(1, 0.01);
+    auto intervals = RectangularMesh<Winterval>(1, 3);
+    intervals.set(0, 0, Winterval(0, 2));
+    intervals.set(1, 0, Winterval(0, 2.001));
+    ASSERT_FALSE(interval_monitor.period(intervals, 1, 1));
+
+    auto real_monitor = ConvergenceMonitor<Real>(1, 0.01);
+    auto reals = RectangularMesh<Real>(1, 3);
+    reals.set(0, 0, 2);
+    reals.set(1, 0, 2.001);
+    ASSERT_EQ(real_monitor.period(reals, 1, 1), 1);
+    ConvergenceMonitor<Real>::fill(reals, 1, 1);
+    ASSERT_EQ(reals.get(2, 0).value(), 2.001);
+}
+
+// Affine forms never repeat, as containment of their bounds does not carry through the scheme.
+TEST(convergence, affine_unsupported) {
+    ASSERT_FALSE(ConvergenceMonitor<AffineForm>::supported);
+    auto monitor = ConvergenceMonitor<AffineForm>(1);
+    auto mesh = RectangularMesh<AffineForm>(1, 2);
+    mesh.set(0, 0, AffineForm(Winterval(0, 1)));
+    mesh.set(1, 0, mesh.get(0, 0));
+    ASSERT_FALSE(monitor.period(mesh, 1, 1));
+}
@@ -0,0 +1,47 @@
+//
+// Created by will on 12/10/25.
+//
+
+#include <gtest/gtest.h>
+
+#include "meshes/DomainDecomposition.hpp"
+
+TEST(decomposition, spans_cover_grid) {
+    for (auto [discretization_size, ranks] : {std::pair<uint64_t, uint32_t>{10, 3}, {7, 7}, {1000, 8}, {5, 1}}) {
+        uint64_t next = 0;
+        for (uint32_t rank = 0; rank < ranks; rank++) {
+            auto decomposition = DomainDecomposition(discretization_size, rank, ranks);
+            // Spans are contiguous, in rank order, and as even as possible.
+            ASSERT_EQ(decomposition.begin(), next);
+            ASSERT_GE(decomposition.size(), discretization_size / ranks);
+            ASSERT_LE(decomposition.size(), discretization_size / ranks + 1);
+            next = decomposition.end();
+        }
+        ASSERT_EQ(next, discretization_size);
+    }
+
+    // Remaining cells go to the first ranks.
+    ASSERT_EQ(DomainDecomposition(10, 0, 3).size(), 4);
+    ASSERT_EQ(DomainDecomposition(10, 1, 3).size(), 3);
+    ASSERT_EQ(DomainDecomposition(10, 2, 3).begin(), 7);
+}
+
+TEST(decomposition, neighbors) {
+    auto first = DomainDecomposition(12, 0, 4);
+    auto middle = DomainDecomposition(12, 2, 4);
+    auto last = DomainDecomposition(12, 3, 4);
+
+    ASSERT_FALSE(first.left_neighbor(false).has_value());
+    ASSERT_EQ(first.left_neighbor(true), 3);
+    ASSERT_EQ(first.right_neighbor(false), 1);
+    ASSERT_EQ(middle.left_neighbor(false), 1);
+    ASSERT_EQ(middle.right_neighbor(true), 3);
+    ASSERT_FALSE(last.right_neighbor(false).has_value());
+    ASSERT_EQ(last.right_neighbor(true), 0);
+
+    // A single rank wraps around to itself.
+    auto single = DomainDecomposition(12, 0, 1);
+    ASSERT_EQ(single.left_neighbor(true), 0);
+    ASSERT_EQ(single.right_neighbor(true), 0);
+    ASSERT_FALSE(single.right_neighbor(false).has_value());
+}
@@ -0,0 +1,107 @@
+//
+// Created by will on 12/9/25.
+//
+
+#include <cmath>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "domains/Real.hpp"
+#include "flux/BurgersFlux.hpp"
+#include "solvers/DivergenceGuard.hpp"
+#include "solvers/difference/LaxFriedrichsSolver.hpp"
+#include "solvers/difference/LeapfrogSolver.hpp"
+#include "solvers/volume/LocalLaxFriedrichsSolver.hpp"
+
+#include "Caffeine/AffineForm.hpp"
+#include "DualDomain/MixedForm.hpp"
+#include "Winterval/Winterval.hpp"
+
+/**
+ * Wide intervals under a large timestep blow up; the guard aborts once any cell is too wide.
+ */
+TEST(divergence, width_abort) {
+    auto initial_conditions = std::vector<Winterval>{Winterval(1, 2), Winterval(2, 3), Winterval(3, 4), Winterval(1, 2)};
+    auto solver = LaxFriedrichsSolver<Winterval>();
+    auto full = solver.solve(initial_conditions, 4, 20, 0.5, 1, new BurgersFlux<Winterval>());
+    ASSERT_FALSE(solver.divergence());
+
+    solver.set_divergence_guard(std::make_shared<DivergenceGuard<Winterval>>(100));
+    auto aborted = solver.solve(initial_conditions, 4, 20, 0.5, 1, new BurgersFlux<Winterval>());
+    auto divergence = solver.divergence();
+    ASSERT_TRUE(divergence);
+    ASSERT_LT(divergence->timestep, 19);
+    ASSERT_GT(divergence->max - divergence->min, 100);
+
+    // Rows up to the divergence are solved as usual, and the cells before the first diverging cell are narrow enough.
+    for (uint64_t t = 0; t <= divergence->timestep; t++) {
+        for (auto x = 0; x < 4; x++) {
+            ASSERT_EQ(aborted.get(t, x).min(), full.get(t, x).min());
+            ASSERT_EQ(aborted.get(t, x).max(), full.get(t, x).max());
+        }
+    }
+    for (uint64_t x = 0; x < divergence->cell; x++) {
+        ASSERT_LE(aborted.get(divergence->timestep, x).max() - aborted.get(divergence->timestep, x).min(), 100);
+    }
+    // Later rows enclose everything.
+    ASSERT_EQ(aborted.get(19, 0).min(), -INFINITY);
+    ASSERT_EQ(aborted.get(19, 3).max(), INFINITY);
+}
+
+TEST(divergence, nonfinite_threshold) {
+    auto mesh = RectangularMesh<Winterval>(4, 1);
+    mesh.set(0, 0, Winterval(0, 1));
+    mesh.set(0, 1, Winterval(0, INFINITY));
+    mesh.set(0, 2, Winterval(NAN, NAN));
+    mesh.set(0, 3, Winterval(0, 1));
+
+    ASSERT_FALSE(DivergenceGuard<Winterval>(0, 2).check(mesh, 0));
+    auto divergence = DivergenceGuard<Winterval>(0, 1).check(mesh, 0);
+    ASSERT_TRUE(divergence);
+    ASSERT_EQ(divergence->cell, 1);
+    ASSERT_EQ(divergence->max, INFINITY);
+
+    // Width limits still apply to finite cells.
+    mesh.set(0, 3, Winterval(0, 10));
+    ASSERT_EQ(DivergenceGuard<Winterval>(5, 2).check(mesh, 0)->cell, 3);
+}
+
+// Reals overflowing to infinity are caught as well.
+TEST(divergence, real_overflow) {
+    auto initial_conditions = std::vector<Real>{1e100, -1e100, 1e100};
+    auto width_values = std::vector<double>{1, 1, 1};
+    auto solver = LocalLaxFriedrichsSolver<Real>();
+    solver.set_divergence_guard(std::make_shared<DivergenceGuard<Real>>());
+    auto aborted = solver.solve(initial_conditions, width_values, 3, 50, 1e100, new BurgersFlux<Real>());
+    ASSERT_TRUE(solver.divergence());
+    ASSERT_TRUE(std::isnan(aborted.get(49, 0).value()));
+}
+
+// The centre of an affine form from [-inf, inf] is NaN, so aborted affine and mixed solutions must still have infinite bounds.
+TEST(divergence, affine_fill) {
+    auto affine = RectangularMesh<AffineForm>(3, 4);
+    DivergenceGuard<AffineForm>::fill(affine, 1);
+    for (uint64_t x = 0; x < 3; x++) {
+        auto bounds = Enclosure<AffineForm>::bounds(affine.get(3, x));
+        ASSERT_EQ(bounds.min(), -INFINITY);
+        ASSERT_EQ(bounds.max(), INFINITY);
+    }
+
+    auto mixed = RectangularMesh<MixedForm>(3, 4);
+    DivergenceGuard<MixedForm>::fill(mixed, 1);
+    auto bounds = Enclosure<MixedForm>::bounds(mixed.get(2, 1));
+    ASSERT_EQ(bounds.min(), -INFINITY);
+    ASSERT_EQ(bounds.max(), INFINITY);
+}
+
+// Rows primed before the scheme advances are checked like any other.
+TEST(divergence, primed_row) {
+    auto initial_conditions = std::vector<Real>{1e200, -1e200, 1e200, -1e200};
+    auto solver = LeapfrogSolver<Real>();
+    solver.set_divergence_guard(std::make_shared<DivergenceGuard<Real>>());
+    auto aborted = solver.solve(initial_conditions, 4, 10, 0.1, 1, new BurgersFlux<Real>());
+    ASSERT_TRUE(solver.divergence());
+    ASSERT_EQ(solver.divergence()->timestep, 1);
+    ASSERT_TRUE(std::isnan(aborted.get(9, 0).value()));
+}
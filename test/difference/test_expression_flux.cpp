@@ -0,0 +1,133 @@
+//
+// Created by will on 12/10/25.
+//
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "Winterval/Winterval.hpp"
+#include "domains/Real.hpp"
+#include "flux/BuckleyLeverettFlux.hpp"
+#include "flux/BurgersFlux.hpp"
+#include "flux/CubicFlux.hpp"
+#include "flux/ExpressionFlux.hpp"
+#include "flux/LwrFlux.hpp"
+#include "solvers/difference/LaxFriedrichsSolver.hpp"
+
+/*
+ * Check that an expression agrees with a compiled flux, its derivative, and its stationary points.
+ */
+static void expect_matches(const std::string &expression, FluxFunction<Real> &&expected) {
+    auto flux = ExpressionFlux<Real>(expression);
+    for (auto value = -2.0; value <= 2.0; value += 0.125) {
+        auto u = Real(value);
+        ASSERT_NEAR(flux.flux(u).value(), expected.flux(u).value(), 1e-12);
+        ASSERT_NEAR(flux.derivative_flux(u).value(), expected.derivative_flux(u).value(), 1e-12);
+        auto evaluation = flux.flux_with_derivative(u);
+        ASSERT_NEAR(evaluation.flux.value(), expected.flux(u).value(), 1e-12);
+        ASSERT_NEAR(evaluation.derivative.value(), expected.derivative_flux(u).value(), 1e-12);
+    }
+
+    auto points = flux.stationary_points();
+    auto expected_points = expected.stationary_points();
+    ASSERT_EQ(points.size(), expected_points.size());
+    for (size_t i = 0; i < points.size(); i++) {
+        ASSERT_NEAR(points[i], expected_points[i], 1e-9);
+    }
+}
+
+TEST(expression_flux, matches_builtin_fluxes) {
+    expect_matches("u^2 / 2", BurgersFlux<Real>());
+    expect_matches("u * (1 - u)", LwrFlux<Real>());
+    expect_matches("u^3", CubicFlux<Real>());
+    expect_matches("u^2 / (u^2 + 0.25 * (1 - u)^2)", BuckleyLeverett<Real>());
+}
+
+/**
+ * Constants fold, trivial operations vanish, and repeated subexpressions are computed once.
+ */
+TEST(expression_flux, simplification) {
+    auto folded = FluxExpression("(1 + 2) * u * 1 + 0 * u^2 - (4 - 4)");
+    ASSERT_EQ(folded.flux_program().instructions.size(), 1);
+    ASSERT_EQ(folded.derivative_program().instructions.size(), 1);
+
+    auto shared = FluxExpression("(u + 1) * (u + 1) - (u + 1)");
+    ASSERT_EQ(shared.flux_program().instructions.size(), 3);
+
+    // The flux and derivative of LWR share 1 - u.
+    auto lwr = FluxExpression("u * (1 - u)");
+    ASSERT_LT(lwr.combined_program().instructions.size(),
+        lwr.flux_program().instructions.size() + lwr.derivative_program().instructions.size());
+    ASSERT_LE(lwr.combined_program().num_registers, 3);
+
+    auto constant = ExpressionFlux<Real>("2 * 3 - 1");
+    ASSERT_EQ(constant.flux(Real(7)).value(), 5);
+    ASSERT_EQ(constant.derivative_flux(Real(7)).value(), 0);
+    ASSERT_TRUE(constant.stationary_points().empty());
+}
+
+TEST(expression_flux, precedence) {
+    auto flux = ExpressionFlux<Real>("-u^2 + 2 * u - 6 / 3 / 2 + 2^3^2 / 512");
+    for (auto value : {-1.5, 0.0, 0.25, 3.0}) {
+        ASSERT_NEAR(flux.flux(Real(value)).value(), -value * value + 2 * value - 1 + 1, 1e-12);
+        ASSERT_NEAR(flux.derivative_flux(Real(value)).value(), -2 * value + 2, 1e-12);
+    }
+    ASSERT_EQ(flux.stationary_points(), std::vector<double>{1});
+}
+
+/**
+ * Over intervals, the expression encloses the flux of every point within the interval.
+ */
+TEST(expression_flux, interval_contains_real) {
+    auto interval_flux = ExpressionFlux<Winterval>("u^2 / (u^2 + 0.25 * (1 - u)^2)");
+    auto real_flux = ExpressionFlux<Real>("u^2 / (u^2 + 0.25 * (1 - u)^2)");
+    auto enclosure = interval_flux.flux_with_derivative(Winterval(0.3, 0.4));
+    for (auto value = 0.3; value <= 0.4; value += 0.01) {
+        auto evaluation = real_flux.flux_with_derivative(Real(value));
+        ASSERT_GE(evaluation.flux.value(), enclosure.flux.min());
+        ASSERT_LE(evaluation.flux.value(), enclosure.flux.max());
+        ASSERT_GE(evaluation.derivative.value(), enclosure.derivative.min());
+        ASSERT_LE(evaluation.derivative.value(), enclosure.derivative.max());
+    }
+}
+
+/**
+ * Constants do not depend on u, so stay exact over unbounded intervals.
+ */
+TEST(expression_flux, unbounded_constant) {
+    auto flux = ExpressionFlux<Winterval>("2 * u + 1");
+    auto derivative = flux.derivative_flux(Winterval(-INFINITY, INFINITY));
+    ASSERT_EQ(derivative.min(), 2);
+    ASSERT_EQ(derivative.max(), 2);
+}
+
+TEST(expression_flux, invalid_numbers) {
+    EXPECT_EXIT(FluxExpression("0x10 * u"), testing::ExitedWithCode(EXIT_FAILURE), "numbers must be decimal");
+    EXPECT_EXIT(FluxExpression("1e999 * u"), testing::ExitedWithCode(EXIT_FAILURE), "numbers must be finite");
+    auto flux = ExpressionFlux<Real>("1.5e2 * u");
+    ASSERT_EQ(flux.derivative_flux(Real(0)).value(), 150);
+}
+
+/**
+ * Solvers over an expression flux match solvers over the compiled flux.
+ */
+TEST(expression_flux, solve_matches_builtin) {
+    uint32_t discretization_size = 8;
+    uint32_t num_timesteps = 10;
+    auto initial_conditions = std::vector<Real>(discretization_size);
+    for (uint32_t x = 0; x < discretization_size; x++) {
+        initial_conditions[x] = 0.1 * x;
+    }
+
+    auto expected = LaxFriedrichsSolver<Real>().solve(initial_conditions, discretization_size, num_timesteps, 0.05, 1, new LwrFlux<Real>());
+    auto solution = LaxFriedrichsSolver<Real, ExpressionFlux<Real>>().solve(initial_conditions, discretization_size, num_timesteps,
+        0.05, 1, new ExpressionFlux<Real>("u - u^2"));
+    for (uint32_t t = 0; t < num_timesteps; t++) {
+        for (uint32_t x = 0; x < discretization_size; x++) {
+            ASSERT_NEAR(solution.get(t, x).value(), expected.get(t, x).value(), 1e-12);
+        }
+    }
+}
@@ -13,6 +13,7 @@
 #include "solvers/difference/LaxFriedrichsSolver.hpp"
 #include "flux/BuckleyLeverettFlux.hpp"
 #include "flux/BurgersFlux.hpp"
+#include "flux/CubicFlux.hpp"
 #include "flux/LwrFlux.hpp"
 
 RectangularMesh<Real> solve_flux(FluxFunction<Real> * f) {
@@ -53,4 +54,30 @@ TEST(flux, buckley_lev_flux) {
     ASSERT_NEAR(solution_matrix.get(2, 1).value(), 3.000000, 0.000001);
     ASSERT_NEAR(solution_matrix.get(2, 2).value(), 1.999999, 0.000001);
     ASSERT_NEAR(solution_matrix.get(2, 3).value(), 3.000000, 0.000001);
-}
\ No newline at end of file
+}
+/**
+ * Fused evaluation must agree with evaluating the flux and its derivative separately.
+ */
+TEST(flux, flux_with_derivative) {
+    auto fluxes = std::vector<FluxFunction<Real> *>{
+        new BurgersFlux<Real>(), new CubicFlux<Real>(), new LwrFlux<Real>(), new BuckleyLeverett<Real>()};
+    auto values = std::vector<double>{-1.5, -0.25, 0, 0.3, 0.8, 2};
+
+    for (auto f : fluxes) {
+        for (auto value : values) {
+            auto evaluation = f->flux_with_derivative(value);
+            ASSERT_NEAR(evaluation.flux.value(), f->flux(value).value(), 1e-12);
+            ASSERT_NEAR(evaluation.derivative.value(), f->derivative_flux(value).value(), 1e-12);
+        }
+        delete f;
+    }
+}
+
+TEST(flux, buckley_lev_derivative) {
+    auto f = BuckleyLeverett<Real>();
+    auto h = 1e-6;
+    for (auto value : std::vector<double>{0.1, 0.3, 0.5, 0.9}) {
+        auto central_difference = (f.flux(value + h).value() - f.flux(value - h).value()) / (2 * h);
+        ASSERT_NEAR(f.derivative_flux(value).value(), central_difference, 1e-6);
+    }
+}
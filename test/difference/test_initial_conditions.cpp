@@ -0,0 +1,94 @@
+//
+// Created by will on 12/10/25.
+//
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Caffeine/AffineForm.hpp"
+#include "DualDomain/MixedForm.hpp"
+#include "domains/Enclosure.hpp"
+#include "domains/Real.hpp"
+#include "exe/experiment/generators/generate_initial_conditions.hpp"
+#include "Winterval/Winterval.hpp"
+
+static const auto values = std::vector<double>{0, 1.5, -2.25, 1e-3, 1e6};
+
+static std::string temp_path(const std::string &name) {
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+/**
+ * Conditions written in binary read back as the same enclosures.
+ */
+template<typename T>
+void assert_binary_round_trip() {
+    auto conditions = widen_conditions<T>(values, 0.125);
+    auto path = temp_path("pdenclose_test_conditions" + binary_conditions_extension);
+    write_initial_conditions<T>(path, conditions);
+    auto read = read_initial_conditions<T>(path);
+    std::filesystem::remove(path);
+
+    ASSERT_EQ(read.size(), conditions.size());
+    for (size_t i = 0; i < conditions.size(); i++) {
+        ASSERT_EQ(Enclosure<T>::bounds(read[i]).min(), Enclosure<T>::bounds(conditions[i]).min());
+        ASSERT_EQ(Enclosure<T>::bounds(read[i]).max(), Enclosure<T>::bounds(conditions[i]).max());
+    }
+}
+
+/**
+ * Tolerance files widen each value v into an enclosure of [v - epsilon, v + epsilon].
+ */
+template<typename T>
+void assert_tolerance_encloses(double epsilon) {
+    auto path = temp_path("pdenclose_test_conditions" + tolerance_conditions_extension);
+    write_tolerance_conditions(path, values, epsilon);
+    auto read = read_initial_conditions<T>(path);
+    std::filesystem::remove(path);
+
+    ASSERT_EQ(read.size(), values.size());
+    for (size_t i = 0; i < values.size(); i++) {
+        auto bounds = Enclosure<T>::bounds(read[i]);
+        ASSERT_LE(bounds.min(), values[i] - epsilon);
+        ASSERT_GE(bounds.max(), values[i] + epsilon);
+    }
+}
+
+TEST(initial_conditions, binary_round_trip) {
+    assert_binary_round_trip<Real>();
+    assert_binary_round_trip<Winterval>();
+    assert_binary_round_trip<AffineForm>();
+    assert_binary_round_trip<MixedForm>();
+}
+
+TEST(initial_conditions, tolerance_encloses) {
+    assert_tolerance_encloses<Winterval>(0.05);
+    assert_tolerance_encloses<AffineForm>(0.05);
+    assert_tolerance_encloses<MixedForm>(0.05);
+    // Negative tolerances widen by their magnitude.
+    assert_tolerance_encloses<Winterval>(-0.05);
+}
+
+// Reals cannot represent uncertainty, so keep each value as is.
+TEST(initial_conditions, tolerance_real) {
+    auto path = temp_path("pdenclose_test_real_conditions" + tolerance_conditions_extension);
+    write_tolerance_conditions(path, values, 0.05);
+    auto read = read_initial_conditions<Real>(path);
+    std::filesystem::remove(path);
+
+    ASSERT_EQ(read.size(), values.size());
+    for (size_t i = 0; i < values.size(); i++) {
+        ASSERT_EQ(read[i].value(), values[i]);
+    }
+}
+
+TEST(initial_conditions, missing_file) {
+    auto missing = temp_path("pdenclose_missing_conditions");
+    EXPECT_EXIT(read_initial_conditions<Winterval>(missing + tolerance_conditions_extension), testing::ExitedWithCode(EXIT_FAILURE),
+        "Could not open");
+    EXPECT_EXIT(read_initial_conditions<Winterval>(missing + binary_conditions_extension), testing::ExitedWithCode(EXIT_FAILURE),
+        "Could not open");
+}
@@ -94,4 +94,29 @@ TEST(leapfrog, affine_approx_mixed) {
     assert_eq_bounded_interval(solution_matrix.get(2, 1).interval_bounds(), Winterval(0.924492, 2.672938));
     assert_eq_bounded_interval(solution_matrix.get(2, 2).interval_bounds(), Winterval(1.918658, 2.997344));
     assert_eq_bounded_interval(solution_matrix.get(2, 3).interval_bounds(), Winterval(2.728068, 3.674502));
-}
\ No newline at end of file
+}
+// Leapfrog primes itself in place with one Lax-Friedrichs step, under the same boundary condition.
+TEST(leapfrog, primed_in_place) {
+    auto initial_conditions = std::vector<Real>{1.0, 2.0, 3.0, 4.0};
+    auto boundary = std::make_shared<OutflowBoundary<Real>>();
+
+    auto leapfrog = LeapfrogSolver<Real>();
+    leapfrog.set_boundary(boundary);
+    auto leapfrog_solution = leapfrog.solve(initial_conditions, 4, 3, 0.02, 1, new CubicFlux<Real>());
+
+    auto friedrichs = LaxFriedrichsSolver<Real>();
+    friedrichs.set_boundary(boundary);
+    auto friedrichs_solution = friedrichs.solve(initial_conditions, 4, 2, 0.02, 1, new CubicFlux<Real>());
+
+    for (auto x = 0; x < 4; x++) {
+        ASSERT_EQ(leapfrog_solution.get(1, x).value(), friedrichs_solution.get(1, x).value());
+    }
+
+    // Kernels compose directly over rows, i.e. a leapfrog step from the primed rows.
+    auto next = std::vector<Real>(4);
+    boundary->fill(leapfrog_solution.row(1), 4, leapfrog_solution.ghost_cells());
+    LeapfrogSolver<Real>::step(leapfrog_solution.row(0), leapfrog_solution.row(1), next.data(), 4, 0.02, 1, new CubicFlux<Real>());
+    for (auto x = 0; x < 4; x++) {
+        ASSERT_EQ(next[x].value(), leapfrog_solution.get(2, x).value());
+    }
+}
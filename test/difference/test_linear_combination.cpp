@@ -0,0 +1,85 @@
+//
+// Created by will on 12/10/25.
+//
+
+#include <gtest/gtest.h>
+#include <type_traits>
+
+#include "Caffeine/AffineForm.hpp"
+#include "Winterval/Winterval.hpp"
+#include "domains/LinearCombination.hpp"
+#include "domains/Real.hpp"
+#include "domains/RealBatch.hpp"
+
+/**
+ * Sums with a single, final constant perform the same operations as writing out the sum, so match it exactly.
+ */
+TEST(linear_combination, real_matches_sum) {
+    auto a = Real(0.1);
+    auto b = Real(-2.7);
+    auto c = Real(1.0 / 3);
+
+    ASSERT_EQ((scaled(a, -1) + 1).evaluate().value(), (a * -1 + 1).value());
+    ASSERT_EQ((scaled(a, 0.3) + b - c + 0.7).evaluate().value(), (a * 0.3 + b - c + 0.7).value());
+    ASSERT_EQ((scaled(c, 1) + scaled(b, 0.25) - 2).evaluate().value(), (c + b * 0.25 - 2).value());
+}
+
+/**
+ * Folded constants and flattened combinations reassociate the sum, so only match it up to rounding.
+ */
+TEST(linear_combination, real_reassociates_sum) {
+    auto a = Real(0.1);
+    auto b = Real(-2.7);
+
+    auto folded = (scaled(a, 1) + 0.2 + 0.3).evaluate().value();
+    auto written = (a + 0.2 + 0.3).value();
+    ASSERT_EQ(folded, (a + (0.2 + 0.3)).value());
+    ASSERT_NE(folded, written);
+    ASSERT_DOUBLE_EQ(folded, written);
+
+    ASSERT_DOUBLE_EQ((scaled(a, 3) - (scaled(b, 0.5) + 1)).evaluate().value(), (a * 3 - (b * 0.5 + 1)).value());
+}
+
+TEST(linear_combination, batch_matches_real) {
+    auto a = RealBatch<4>();
+    auto b = RealBatch<4>();
+    for (uint32_t lane = 0; lane < 4; lane++) {
+        a.set(lane, 0.1 * lane - 0.2);
+        b.set(lane, 1.7 / (lane + 1));
+    }
+
+    RealBatch<4> combination = scaled(a, 0.3) - b + 0.25;
+    for (uint32_t lane = 0; lane < 4; lane++) {
+        ASSERT_EQ(combination.value(lane), (Real(a.value(lane)) * 0.3 - Real(b.value(lane)) + 0.25).value());
+    }
+}
+
+/**
+ * Combinations copy their terms, so may outlive the temporaries they were built from.
+ */
+TEST(linear_combination, outlives_temporaries) {
+    auto a = Real(0.1);
+    auto combination = scaled(a * 2, 0.5) + Real(-2.7) * 3 + 1;
+    a = Real(100);
+    ASSERT_EQ(combination.evaluate().value(), (Real(0.1) * 2 * 0.5 + Real(-2.7) * 3 + 1).value());
+}
+
+/**
+ * Domains without a fused evaluation are not collected into combinations, so evaluate exactly as written.
+ */
+TEST(linear_combination, unfused_matches_sum) {
+    static_assert(std::is_same_v<decltype(scaled(Winterval(), 1)), Winterval>);
+    static_assert(std::is_same_v<decltype(scaled(AffineForm(), 1)), AffineForm>);
+
+    auto a = Winterval(0.1, 0.2);
+    auto b = Winterval(-1, 0.5);
+    Winterval interval = scaled(a, -1) + b + 1;
+    auto expected = a * -1 + b + 1;
+    ASSERT_EQ(interval.min(), expected.min());
+    ASSERT_EQ(interval.max(), expected.max());
+
+    auto x = AffineForm(a);
+    auto y = AffineForm(b);
+    AffineForm affine = scaled(x, 0.25) - y;
+    ASSERT_TRUE(affine == x * 0.25 - y);
+}
@@ -2,7 +2,10 @@
 // Created by will on 10/23/25.
 //
 
+#include <fcntl.h>
+#include <filesystem>
 #include <fstream>
+#include <unistd.h>
 
 #include "domains/Real.hpp"
 #include "gtest/gtest.h"
@@ -104,4 +107,59 @@ TEST(serialization, serialize_mixed) {
 
     auto deserialized_matrix = RectangularMesh<MixedForm>::from_json_string(strrep);
     ASSERT_TRUE(solution_matrix.equals(deserialized_matrix));
-}
\ No newline at end of file
+}
+
+/**
+ * Serialize a mesh spanning several chunks through a file descriptor.
+ */
+TEST(serialization, serialize_file_chunks) {
+    uint32_t discretization_size = 100;
+    uint32_t num_timesteps = 100;
+    double delta_t = 0.02;
+    double delta_x = 1;
+
+    auto initial_conditions = std::vector<Winterval>(discretization_size);
+    for (uint32_t i = 0; i < discretization_size; i++) {
+        initial_conditions[i] = Winterval(i * 0.01, i * 0.01 + 0.1);
+    }
+
+    auto solution_matrix = LaxFriedrichsSolver<Winterval>().solve(initial_conditions, discretization_size, num_timesteps, delta_t, delta_x, new CubicFlux<Winterval>());
+    auto path = (std::filesystem::temp_directory_path() / "pdenclose_test_serialization.json").string();
+
+    auto fd = open(path.c_str(), O_CREAT | O_TRUNC | O_WRONLY, 0644);
+    ASSERT_GE(fd, 0);
+    solution_matrix.write_json(fd);
+    close(fd);
+
+    fd = open(path.c_str(), O_RDONLY);
+    ASSERT_GE(fd, 0);
+    auto deserialized_matrix = RectangularMesh<Winterval>::read_json(fd);
+    close(fd);
+    std::filesystem::remove(path);
+
+    ASSERT_TRUE(solution_matrix.equals(deserialized_matrix));
+    // String and file representations are interchangeable.
+    ASSERT_TRUE(solution_matrix.equals(RectangularMesh<Winterval>::from_json_string(solution_matrix.to_json_string())));
+}
+
+/**
+ * Meshes whose cells do not match their header, or do not parse, are reported rather than read.
+ */
+TEST(serialization, malformed_json) {
+    auto mesh = RectangularMesh<Real>(4, 2);
+    auto json = mesh.to_json_string();
+
+    auto shrunk = json;
+    auto field = shrunk.find("\"discretization_size\"");
+    ASSERT_NE(field, std::string::npos);
+    auto digit = shrunk.find('4', field);
+    shrunk[digit] = '3';
+    EXPECT_EXIT(RectangularMesh<Real>::from_json_string(shrunk), ::testing::ExitedWithCode(EXIT_FAILURE), "Malformed mesh");
+
+    auto garbled = json;
+    auto system = garbled.find('[', garbled.find("\"system\""));
+    garbled.insert(system + 1, "\"cell\",");
+    EXPECT_EXIT(RectangularMesh<Real>::from_json_string(garbled), ::testing::ExitedWithCode(EXIT_FAILURE), "Malformed mesh");
+
+    EXPECT_EXIT(RectangularMesh<Real>::from_json_string("{}"), ::testing::ExitedWithCode(EXIT_FAILURE), "Malformed mesh");
+}
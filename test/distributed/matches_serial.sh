@@ -0,0 +1,29 @@
+#!/usr/bin/env bash
+# Check that a distributed run writes the same solution as a serial run, for several schemes and domains.
+# Usage: matches_serial.sh <PDEapprox executable> <mpiexec> <ranks>
+
+set -e
+executable="$1"
+mpiexec="$2"
+ranks="$3"
+
+work_dir="$(mktemp -d)"
+trap 'rm -rf "$work_dir"' EXIT
+cd "$work_dir"
+"$executable" -w > /dev/null
+
+# Allow containers running as root, and more ranks than cores.
+export OMPI_ALLOW_RUN_AS_ROOT=1 OMPI_ALLOW_RUN_AS_ROOT_CONFIRM=1 OMPI_MCA_rmaps_base_oversubscribe=1
+
+for run in real_burgers_lax_friedrichs:burgers_real real_burgers_leapfrog:burgers_real \
+    interval_lwr_local_lax_friedrichs:lwr_interval real_burgers_local_lax_friedrichs_refined:burgers_real; do
+    config="simulations/${run%%:*}_config.json"
+    conditions="simulations/${run##*:}_conds.json"
+    "$executable" -c "$config" -s "$conditions" -o serial.txt > /dev/null
+    "$mpiexec" -n "$ranks" "$executable" -c "$config" -s "$conditions" -o distributed.txt > /dev/null
+    if ! cmp -s serial.txt distributed.txt; then
+        echo "${run%%:*} differs between serial and $ranks ranks:"
+        diff serial.txt distributed.txt | head -n 10
+        exit 1
+    fi
+done
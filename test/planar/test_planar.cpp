@@ -0,0 +1,189 @@
+//
+// Created by will on 12/10/25.
+//
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <memory>
+#include <numbers>
+
+#include "Winterval/Winterval.hpp"
+#include "domains/Real.hpp"
+#include "flux/BurgersFlux.hpp"
+#include "flux/LwrFlux.hpp"
+#include "solvers/planar/SplitLaxFriedrichsSolver.hpp"
+#include "solvers/planar/SplitLocalLaxFriedrichsSolver.hpp"
+#include "solvers/volume/LocalLaxFriedrichsSolver.hpp"
+
+/*
+ * Smooth bump over a periodic grid of width x height cells.
+ */
+static PlanarMesh<Real> bump(uint64_t width, uint64_t height) {
+    auto mesh = PlanarMesh<Real>(width, height);
+    for (uint64_t y = 0; y < height; y++) {
+        for (uint64_t x = 0; x < width; x++) {
+            auto phase_x = 2 * std::numbers::pi * (x + 0.5) / width;
+            auto phase_y = 2 * std::numbers::pi * (y + 0.5) / height;
+            mesh.set(x, y, 0.5 + 0.2 * std::sin(phase_x) * std::cos(phase_y) + 0.1 * std::cos(phase_y));
+        }
+    }
+    return mesh;
+}
+
+TEST(planar, fill_ghosts) {
+    auto mesh = PlanarMesh<Real>(3, 4, 2);
+    for (uint64_t y = 0; y < 4; y++) {
+        for (uint64_t x = 0; x < 3; x++) {
+            mesh.set(x, y, 10 * y + x);
+        }
+    }
+
+    mesh.fill_column_ghosts(PeriodicBoundary<Real>());
+    for (auto x = 0; x < 3; x++) {
+        ASSERT_EQ(mesh.row(-1)[x].value(), 30 + x);
+        ASSERT_EQ(mesh.row(-2)[x].value(), 20 + x);
+        ASSERT_EQ(mesh.row(4)[x].value(), x);
+        ASSERT_EQ(mesh.row(5)[x].value(), 10 + x);
+    }
+    mesh.fill_column_ghosts(OutflowBoundary<Real>());
+    for (auto x = 0; x < 3; x++) {
+        ASSERT_EQ(mesh.row(-2)[x].value(), x);
+        ASSERT_EQ(mesh.row(5)[x].value(), 30 + x);
+    }
+
+    mesh.fill_row_ghosts(PeriodicBoundary<Real>());
+    for (auto y = 0; y < 4; y++) {
+        ASSERT_EQ(mesh.row(y)[-1].value(), 10 * y + 2);
+        ASSERT_EQ(mesh.row(y)[3].value(), 10 * y);
+    }
+}
+
+/**
+ * Each sweep is conservative, so the total over a periodic grid is constant, and a constant state stays constant.
+ */
+TEST(planar, conservation) {
+    auto width = 24;
+    auto height = 16;
+    auto delta_x = 1.0 / width;
+    auto delta_y = 1.0 / height;
+    auto delta_t = 0.01;
+    auto initial_state = bump(width, height);
+    auto total = [&](const PlanarMesh<Real> &state) {
+        auto sum = 0.0;
+        for (auto y = 0; y < height; y++) {
+            for (auto x = 0; x < width; x++) {
+                sum += state.get(x, y).value() * delta_x * delta_y;
+            }
+        }
+        return sum;
+    };
+
+    auto solver = SplitLocalLaxFriedrichsSolver<Real>();
+    ASSERT_TRUE(solver.cfl_check_mesh(initial_state, new BurgersFlux<Real>, new LwrFlux<Real>, delta_t, delta_x, delta_y));
+    auto solution = solver.solve(initial_state, 15, delta_t, delta_x, delta_y, new BurgersFlux<Real>, new LwrFlux<Real>);
+    ASSERT_NEAR(total(solution), total(initial_state), 1e-12);
+
+    auto constant = PlanarMesh<Real>(width, height);
+    for (auto y = 0; y < height; y++) {
+        for (auto x = 0; x < width; x++) {
+            constant.set(x, y, 0.3);
+        }
+    }
+    for (SplitSolver<Real, FluxFunction<Real>> *scheme : {static_cast<SplitSolver<Real, FluxFunction<Real>> *>(&solver),
+            static_cast<SplitSolver<Real, FluxFunction<Real>> *>(new SplitLaxFriedrichsSolver<Real>())}) {
+        auto constant_solution = scheme->solve(constant, 7, delta_t, delta_x, delta_y, new BurgersFlux<Real>, new BurgersFlux<Real>);
+        for (auto y = 0; y < height; y++) {
+            for (auto x = 0; x < width; x++) {
+                ASSERT_NEAR(constant_solution.get(x, y).value(), 0.3, 1e-12);
+            }
+        }
+    }
+}
+
+/**
+ * A state varying only in x never changes in y, so every row follows the 1d scheme.
+ */
+TEST(planar, matches_one_dimension) {
+    auto width = 20;
+    auto height = 6;
+    auto num_timesteps = 12;
+    auto delta_t = 0.02;
+    auto delta_x = 0.1;
+    auto initial_conditions = std::vector<Real>(width);
+    auto initial_state = PlanarMesh<Real>(width, height);
+    for (auto x = 0; x < width; x++) {
+        initial_conditions[x] = x < width / 2 ? 1.0 + 0.05 * x : -0.25;
+        for (auto y = 0; y < height; y++) {
+            initial_state.set(x, y, initial_conditions[x]);
+        }
+    }
+
+    auto line = LocalLaxFriedrichsSolver<Real>().solve(initial_conditions, std::vector<double>(width, delta_x), width,
+        num_timesteps + 1, delta_t, new BurgersFlux<Real>);
+    auto solution = SplitLocalLaxFriedrichsSolver<Real>().solve(initial_state, num_timesteps, delta_t, delta_x, 0.1,
+        new BurgersFlux<Real>, new BurgersFlux<Real>);
+    for (auto y = 0; y < height; y++) {
+        for (auto x = 0; x < width; x++) {
+            ASSERT_NEAR(solution.get(x, y).value(), line.get(num_timesteps, x).value(), 1e-12);
+        }
+    }
+}
+
+/**
+ * Tiles only partition the work, so any tile size gives the same solution.
+ */
+TEST(planar, tile_independence) {
+    auto width = 37;
+    auto height = 29;
+    auto initial_state = bump(width, height);
+
+    auto check = [&](SplitSolver<Real, FluxFunction<Real>> &solver) {
+        solver.set_boundaries(std::make_shared<OutflowBoundary<Real>>(), std::make_shared<ReflectiveBoundary<Real>>());
+        auto untiled = solver.solve(initial_state, 9, 0.01, 1.0 / width, 1.0 / height, new BurgersFlux<Real>, new LwrFlux<Real>);
+        solver.set_tile_size(8, 5);
+        auto tiled = solver.solve(initial_state, 9, 0.01, 1.0 / width, 1.0 / height, new BurgersFlux<Real>, new LwrFlux<Real>);
+        for (auto y = 0; y < height; y++) {
+            for (auto x = 0; x < width; x++) {
+                ASSERT_EQ(tiled.get(x, y).value(), untiled.get(x, y).value());
+            }
+        }
+    };
+    auto lax_friedrichs = SplitLaxFriedrichsSolver<Real>();
+    check(lax_friedrichs);
+    auto local_lax_friedrichs = SplitLocalLaxFriedrichsSolver<Real>();
+    check(local_lax_friedrichs);
+}
+
+/**
+ * Solving over intervals encloses the real solutions from within the initial intervals.
+ */
+TEST(planar, interval_contains_real) {
+    auto width = 6;
+    auto height = 5;
+    auto num_timesteps = 4;
+    auto delta_t = 0.02;
+    auto lower_state = PlanarMesh<Real>(width, height);
+    auto upper_state = PlanarMesh<Real>(width, height);
+    auto interval_state = PlanarMesh<Winterval>(width, height);
+    for (auto y = 0; y < height; y++) {
+        for (auto x = 0; x < width; x++) {
+            auto lower = 0.3 + 0.1 * ((x * 7 + y * 3) % 5);
+            lower_state.set(x, y, lower);
+            upper_state.set(x, y, lower + 0.001);
+            interval_state.set(x, y, Winterval(lower, lower + 0.001));
+        }
+    }
+
+    auto interval_solution = SplitLocalLaxFriedrichsSolver<Winterval>().solve(interval_state, num_timesteps, delta_t, 0.1, 0.1,
+        new BurgersFlux<Winterval>, new LwrFlux<Winterval>);
+    for (const auto *state : {&lower_state, &upper_state}) {
+        auto real_solution = SplitLocalLaxFriedrichsSolver<Real>().solve(*state, num_timesteps, delta_t, 0.1, 0.1,
+            new BurgersFlux<Real>, new LwrFlux<Real>);
+        for (auto y = 0; y < height; y++) {
+            for (auto x = 0; x < width; x++) {
+                ASSERT_GE(real_solution.get(x, y).value(), interval_solution.get(x, y).min() - 1e-12);
+                ASSERT_LE(real_solution.get(x, y).value(), interval_solution.get(x, y).max() + 1e-12);
+            }
+        }
+    }
+}
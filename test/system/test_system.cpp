@@ -0,0 +1,197 @@
+//
+// Created by will on 12/10/25.
+//
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <utility>
+
+#include "Winterval/Winterval.hpp"
+#include "domains/Real.hpp"
+#include "flux/BurgersFlux.hpp"
+#include "flux/IsothermalEulerFlux.hpp"
+#include "flux/ShallowWaterFlux.hpp"
+#include "solvers/system/SystemLaxFriedrichsSolver.hpp"
+#include "solvers/system/SystemLocalLaxFriedrichsSolver.hpp"
+#include "solvers/volume/LocalLaxFriedrichsSolver.hpp"
+
+/*
+ * Burgers' equation as a system of one component, with the absolute derivative as its spectral radius.
+ */
+class BurgersSystemFlux final : public SystemFluxFunction<Real, 1> {
+public:
+    SystemState<Real, 1> flux(const SystemState<Real, 1> &state) override {
+        return {_flux.flux(state[0])};
+    }
+    Real spectral_radius(const SystemState<Real, 1> &state) override {
+        return _flux.derivative_flux(state[0]).abs();
+    }
+
+private:
+    BurgersFlux<Real> _flux;
+};
+
+/*
+ * Dam break: deep water on the left half of a periodic channel of the given size, at rest.
+ */
+static std::array<std::vector<Real>, 2> dam_break(uint32_t discretization_size) {
+    auto height = std::vector<Real>(discretization_size);
+    auto discharge = std::vector<Real>(discretization_size, 0);
+    for (uint32_t x = 0; x < discretization_size; x++) {
+        height[x] = x < discretization_size / 2 ? 2 : 1;
+    }
+    return {height, discharge};
+}
+
+/**
+ * With one component, the system scheme is the scalar scheme.
+ */
+TEST(system, scalar_matches_local_lax_friedrichs) {
+    auto discretization_size = 6;
+    auto num_timesteps = 20;
+    auto initial_conditions = std::vector<Real>{0.1, 0.4, 0.9, 0.7, 0.3, 0.2};
+    auto width_values = std::vector<double>{1, 0.5, 0.25, 0.25, 0.5, 1};
+    auto delta_t = 0.05;
+
+    auto scalar = LocalLaxFriedrichsSolver<Real>().solve(initial_conditions, width_values, discretization_size, num_timesteps, delta_t, new BurgersFlux<Real>);
+    auto system = SystemLocalLaxFriedrichsSolver<Real, 1>().solve({initial_conditions}, width_values, discretization_size, num_timesteps, delta_t, new BurgersSystemFlux);
+    for (auto t = 0; t < num_timesteps; t++) {
+        for (auto x = 0; x < discretization_size; x++) {
+            ASSERT_NEAR(system.component(0).get(t, x).value(), scalar.get(t, x).value(), 1e-12);
+        }
+    }
+}
+
+/**
+ * Both schemes conserve every component with periodic boundaries, and keep the water height positive.
+ */
+TEST(system, shallow_water_conservation) {
+    auto discretization_size = 40;
+    auto num_timesteps = 30;
+    auto width_values = std::vector<double>(discretization_size, 0.1);
+    auto delta_t = 0.01;
+    auto flux = ShallowWaterFlux<Real>(9.81, 1.5);
+
+    auto check = [&](SystemSolver<Real, 2> &solver) {
+        auto solution = solver.solve(dam_break(discretization_size), width_values, discretization_size, num_timesteps, delta_t, &flux);
+        ASSERT_TRUE(solver.cfl_check_mesh(solution, &flux, delta_t, width_values));
+        auto total = [&](size_t component, uint32_t timestep) {
+            auto sum = 0.0;
+            for (auto x = 0; x < discretization_size; x++) {
+                sum += solution.component(component).get(timestep, x).value() * width_values[x];
+            }
+            return sum;
+        };
+        for (auto t = 0; t < num_timesteps; t++) {
+            ASSERT_NEAR(total(0, t), total(0, 0), 1e-12);
+            ASSERT_NEAR(total(1, t), total(1, 0), 1e-12);
+            for (auto x = 0; x < discretization_size; x++) {
+                ASSERT_GT(solution.component(0).get(t, x).value(), 0.9);
+            }
+        }
+        // Water flows from the deep side over the dam.
+        ASSERT_GT(solution.component(1).get(num_timesteps - 1, discretization_size / 2).value(), 0.1);
+    };
+    auto lax_friedrichs = SystemLaxFriedrichsSolver<Real, 2>();
+    check(lax_friedrichs);
+    auto local_lax_friedrichs = SystemLocalLaxFriedrichsSolver<Real, 2>();
+    check(local_lax_friedrichs);
+}
+
+/**
+ * Still water stays still.
+ */
+TEST(system, still_water) {
+    auto discretization_size = 10;
+    auto num_timesteps = 10;
+    auto initial_state = std::array<std::vector<Real>, 2>{std::vector<Real>(discretization_size, 1.5), std::vector<Real>(discretization_size, 0)};
+    auto width_values = std::vector<double>(discretization_size, 0.1);
+
+    auto solution = SystemLocalLaxFriedrichsSolver<Real, 2, ShallowWaterFlux<Real>>().solve(initial_state, width_values, discretization_size, num_timesteps, 0.01, new ShallowWaterFlux<Real>);
+    for (auto x = 0; x < discretization_size; x++) {
+        ASSERT_NEAR(solution.component(0).get(num_timesteps - 1, x).value(), 1.5, 1e-12);
+        ASSERT_NEAR(solution.component(1).get(num_timesteps - 1, x).value(), 0, 1e-12);
+    }
+}
+
+/**
+ * Taking the viscosity of the fastest cell everywhere smears the dam break more than taking it locally.
+ */
+TEST(system, lax_friedrichs_more_diffusive) {
+    auto discretization_size = 40;
+    auto num_timesteps = 30;
+    auto width_values = std::vector<double>(discretization_size, 0.1);
+    auto flux = IsothermalEulerFlux<Real>(1);
+
+    auto total_variation = [&](const SystemMesh<Real, 2> &solution) {
+        auto sum = 0.0;
+        for (auto x = 1; x < discretization_size; x++) {
+            sum += std::abs(solution.component(0).get(num_timesteps - 1, x).value() - solution.component(0).get(num_timesteps - 1, x - 1).value());
+        }
+        return sum;
+    };
+    auto global = SystemLaxFriedrichsSolver<Real, 2>().solve(dam_break(discretization_size), width_values, discretization_size, num_timesteps, 0.02, &flux);
+    auto local = SystemLocalLaxFriedrichsSolver<Real, 2>().solve(dam_break(discretization_size), width_values, discretization_size, num_timesteps, 0.02, &flux);
+    ASSERT_LT(total_variation(global), total_variation(local));
+}
+
+/**
+ * Solving over intervals encloses the real solutions from within the initial intervals.
+ */
+TEST(system, interval_contains_real) {
+    auto discretization_size = 8;
+    auto num_timesteps = 6;
+    auto width_values = std::vector<double>(discretization_size, 0.25);
+    auto delta_t = 0.02;
+
+    auto lower_state = dam_break(discretization_size);
+    auto upper_state = dam_break(discretization_size);
+    auto interval_state = std::array<std::vector<Winterval>, 2>{std::vector<Winterval>(discretization_size), std::vector<Winterval>(discretization_size)};
+    for (auto c = 0; c < 2; c++) {
+        for (auto x = 0; x < discretization_size; x++) {
+            auto value = lower_state[c][x].value() + 0.01 * x;
+            interval_state[c][x] = Winterval(value, value + 0.001);
+            lower_state[c][x] = value;
+            upper_state[c][x] = value + 0.001;
+        }
+    }
+
+    auto interval_solution = SystemLocalLaxFriedrichsSolver<Winterval, 2>().solve(interval_state, width_values, discretization_size,
+        num_timesteps, delta_t, new IsothermalEulerFlux<Winterval>(1));
+    for (const auto &state : {lower_state, upper_state}) {
+        auto real_solution = SystemLocalLaxFriedrichsSolver<Real, 2>().solve(state, width_values, discretization_size,
+            num_timesteps, delta_t, new IsothermalEulerFlux<Real>(1));
+        for (auto t = 0; t < num_timesteps; t++) {
+            for (auto c = 0; c < 2; c++) {
+                for (auto x = 0; x < discretization_size; x++) {
+                    ASSERT_GE(real_solution.component(c).get(t, x).value(), interval_solution.component(c).get(t, x).min() - 1e-12);
+                    ASSERT_LE(real_solution.component(c).get(t, x).value(), interval_solution.component(c).get(t, x).max() + 1e-12);
+                }
+            }
+        }
+    }
+}
+
+/*
+ * Exposes the viscosity bound shared by the system schemes.
+ */
+class ViscosityProbe final : public SystemSolver<Winterval, 1> {
+public:
+    using SystemSolver<Winterval, 1>::larger;
+
+protected:
+    void interface_viscosities(const Winterval *, Winterval *, int64_t) const override {}
+};
+
+/**
+ * Over intervals, the larger spectral radius encloses the larger of every pair of enclosed radii,
+ * whichever interval compares larger.
+ */
+TEST(system, larger_encloses_max) {
+    for (const auto &[left, right] : {std::pair(Winterval(0, 3), Winterval(1, 2)), std::pair(Winterval(1, 2), Winterval(0, 3)),
+        std::pair(Winterval(0, 2), Winterval(1, 3))}) {
+        auto larger = ViscosityProbe::larger(left, right);
+        ASSERT_LE(larger.min(), std::max(left.min(), right.min()));
+        ASSERT_GE(larger.max(), std::max(left.max(), right.max()));
+    }
+}
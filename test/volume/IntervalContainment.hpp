@@ -0,0 +1,56 @@
+//
+// Created by will on 12/10/25.
+//
+
+#ifndef PDENCLOSE_INTERVALCONTAINMENT_H
+#define PDENCLOSE_INTERVALCONTAINMENT_H
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Winterval/Winterval.hpp"
+#include "domains/Real.hpp"
+#include "flux/BurgersFlux.hpp"
+
+/*
+ * Check that solving Burgers' equation over intervals encloses the real solutions from either end of each initial interval.
+ * Initial intervals start from a fixed set of values, one per cell.
+ *
+ * @param make_solver Builds the solver for a domain, given a value of it, i.e. [](auto domain) { return MusclSolver<decltype(domain)>(); }
+ * @param width_values Width of each cell, at most 6 cells.
+ * @param num_timesteps Number of timesteps to solve.
+ * @param delta_t Time discretization.
+ * @param spread Width of each initial interval.
+ */
+template<typename M>
+void expect_interval_contains_real(M &&make_solver, const std::vector<double> &width_values, uint32_t num_timesteps,
+    double delta_t, double spread) {
+    auto lower = std::vector<double>{1.39, 2.66, 2.84, 2.75, 1.21, 1.5};
+    ASSERT_LE(width_values.size(), lower.size());
+    auto discretization_size = static_cast<uint32_t>(width_values.size());
+
+    auto interval_conditions = std::vector<Winterval>(discretization_size);
+    auto lower_conditions = std::vector<Real>(discretization_size);
+    auto upper_conditions = std::vector<Real>(discretization_size);
+    for (uint32_t x = 0; x < discretization_size; x++) {
+        interval_conditions[x] = Winterval(lower[x], lower[x] + spread);
+        lower_conditions[x] = lower[x];
+        upper_conditions[x] = lower[x] + spread;
+    }
+
+    auto interval_solution = make_solver(Winterval()).solve(interval_conditions, width_values, discretization_size, num_timesteps,
+        delta_t, new BurgersFlux<Winterval>);
+    for (const auto &conditions : {lower_conditions, upper_conditions}) {
+        auto real_solution = make_solver(Real()).solve(conditions, width_values, discretization_size, num_timesteps, delta_t,
+            new BurgersFlux<Real>);
+        for (uint32_t t = 0; t < num_timesteps; t++) {
+            for (uint32_t x = 0; x < discretization_size; x++) {
+                ASSERT_GE(real_solution.get(t, x).value(), interval_solution.get(t, x).min() - 1e-12);
+                ASSERT_LE(real_solution.get(t, x).value(), interval_solution.get(t, x).max() + 1e-12);
+            }
+        }
+    }
+}
+
+#endif //PDENCLOSE_INTERVALCONTAINMENT_H
@@ -0,0 +1,31 @@
+//
+// Created by will on 12/10/25.
+//
+
+#ifndef PDENCLOSE_SMOOTHBURGERS_H
+#define PDENCLOSE_SMOOTHBURGERS_H
+#include <cmath>
+#include <numbers>
+
+/*
+ * Smooth initial condition for Burgers' equation on [0, 1]. Shocks form at t = 2 / pi.
+ */
+inline double smooth_initial(double x) {
+    return 0.5 + 0.25 * std::sin(2 * std::numbers::pi * x);
+}
+
+/*
+ * Exact solution of Burgers' equation from smooth_initial before shocks form, by solving u = u0(x - ut) along characteristics.
+ */
+inline double smooth_exact(double x, double t) {
+    auto u = smooth_initial(x);
+    for (auto i = 0; i < 100; i++) {
+        auto foot = x - u * t;
+        auto residual = u - smooth_initial(foot);
+        auto slope = 1 + 0.25 * 2 * std::numbers::pi * std::cos(2 * std::numbers::pi * foot) * t;
+        u -= residual / slope;
+    }
+    return u;
+}
+
+#endif //PDENCLOSE_SMOOTHBURGERS_H
@@ -0,0 +1,172 @@
+//
+// Created by will on 12/10/25.
+//
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <memory>
+
+#include "Winterval/Winterval.hpp"
+#include "domains/Real.hpp"
+#include "flux/BurgersFlux.hpp"
+#include "solvers/volume/AdaptiveSolver.hpp"
+#include "solvers/volume/RiemannSolver.hpp"
+
+/*
+ * Adaptive solver over a locally time stepped Godunov scheme, regridding every two timesteps.
+ */
+template<typename T>
+static AdaptiveSolver<T, BurgersFlux<T>> adaptive_solver(RefinementCriterion criterion, double threshold) {
+    auto scheme = std::make_shared<RiemannSolver<T, BurgersFlux<T>>>();
+    scheme->set_local_time_stepping(true);
+    auto solver = AdaptiveSolver<T, BurgersFlux<T>>();
+    solver.set_scheme(scheme);
+    solver.set_refinement(criterion, threshold, 2, 2);
+    return solver;
+}
+
+/*
+ * Burgers' equation from a shock, and a rarefaction behind it, on a periodic grid of the given size over [0, 4).
+ */
+static std::vector<Real> step_conditions(uint32_t discretization_size) {
+    auto initial_conditions = std::vector<Real>(discretization_size);
+    for (uint32_t x = 0; x < discretization_size; x++) {
+        auto position = (x + 0.5) * 4 / discretization_size;
+        initial_conditions[x] = position >= 1 && position < 2 ? 1 : 0;
+    }
+    return initial_conditions;
+}
+
+/**
+ * Regridding transfers mass exactly between levels, and the refined scheme conserves it, even on nonuniform grids.
+ */
+TEST(amr, conservation) {
+    auto discretization_size = 16;
+    auto num_timesteps = 21;
+    auto initial_conditions = step_conditions(discretization_size);
+    auto width_values = std::vector<double>(discretization_size, 0.25);
+    width_values[6] = 0.125;
+    width_values[7] = 0.375;
+    auto delta_t = 0.1;
+
+    auto solver = adaptive_solver<Real>(RefinementCriterion::gradient, 0.05);
+    solver.track_cfl(true);
+    auto solution = solver.solve(initial_conditions, width_values, discretization_size, num_timesteps, delta_t, new BurgersFlux<Real>);
+    ASSERT_TRUE(solver.tracked_cfl_check());
+
+    auto mass = [&](uint32_t timestep) {
+        auto total = 0.0;
+        for (auto x = 0; x < discretization_size; x++) {
+            total += solution.get(timestep, x).value() * width_values[x];
+        }
+        return total;
+    };
+    for (auto t = 0; t < num_timesteps; t++) {
+        ASSERT_NEAR(mass(t), mass(0), 1e-12);
+    }
+}
+
+/**
+ * Blocks are refined around the shock, and left coarse where the solution is flat.
+ */
+TEST(amr, refines_features) {
+    auto discretization_size = 64;
+    auto num_timesteps = 9;
+    auto width_values = std::vector<double>(discretization_size, 4.0 / discretization_size);
+
+    auto solver = adaptive_solver<Real>(RefinementCriterion::gradient, 0.05);
+    auto solution = solver.solve(step_conditions(discretization_size), width_values, discretization_size, num_timesteps, 0.05, new BurgersFlux<Real>);
+
+    // The shock starts at x = 2 and moves at speed 1/2.
+    auto shock = static_cast<uint32_t>((2 + 0.5 * (num_timesteps - 1) * 0.05) / 4 * discretization_size);
+    ASSERT_EQ(solver.levels()[shock], 2);
+    ASSERT_EQ(solver.levels()[discretization_size - 1], 0);
+    ASSERT_EQ(solver.levels()[0], 0);
+    ASSERT_LT(solver.peak_cells(), discretization_size * 2);
+}
+
+/**
+ * Refining around features reaches nearly the accuracy of refining everywhere, with far fewer cells.
+ */
+TEST(amr, matches_uniform_refinement) {
+    auto discretization_size = 64;
+    auto num_timesteps = 17;
+    auto delta_t = 0.05;
+    auto width = 4.0 / discretization_size;
+
+    // Reference solution refined everywhere, averaged over each coarse cell.
+    auto fine_size = discretization_size * 4;
+    auto reference = RiemannSolver<Real>().solve(step_conditions(fine_size), std::vector<double>(fine_size, width / 4),
+        fine_size, (num_timesteps - 1) * 4 + 1, delta_t / 4, new BurgersFlux<Real>);
+    auto error = [&](const RectangularMesh<Real> &solution) {
+        auto total = 0.0;
+        for (auto x = 0; x < discretization_size; x++) {
+            auto average = 0.0;
+            for (auto i = 0; i < 4; i++) {
+                average += reference.get((num_timesteps - 1) * 4, x * 4 + i).value() / 4;
+            }
+            total += std::abs(solution.get(num_timesteps - 1, x).value() - average) * width;
+        }
+        return total;
+    };
+
+    auto width_values = std::vector<double>(discretization_size, width);
+    auto coarse = RiemannSolver<Real>().solve(step_conditions(discretization_size), width_values, discretization_size, num_timesteps, delta_t, new BurgersFlux<Real>);
+    auto solver = adaptive_solver<Real>(RefinementCriterion::gradient, 0.05);
+    auto adaptive = solver.solve(step_conditions(discretization_size), width_values, discretization_size, num_timesteps, delta_t, new BurgersFlux<Real>);
+
+    ASSERT_LT(error(adaptive), error(coarse) / 2);
+    ASSERT_LT(solver.peak_cells(), fine_size / 2);
+}
+
+/**
+ * A flat solution is never refined, so matches the scheme alone.
+ */
+TEST(amr, unrefined_matches_scheme) {
+    auto discretization_size = 12;
+    auto num_timesteps = 10;
+    auto initial_conditions = std::vector<Real>(discretization_size);
+    for (auto x = 0; x < discretization_size; x++) {
+        initial_conditions[x] = 0.5 + 0.01 * x;
+    }
+    auto width_values = std::vector<double>(discretization_size, 0.1);
+
+    auto solver = adaptive_solver<Real>(RefinementCriterion::gradient, 0.5);
+    auto adaptive = solver.solve(initial_conditions, width_values, discretization_size, num_timesteps, 0.02, new BurgersFlux<Real>);
+    auto scheme = RiemannSolver<Real>().solve(initial_conditions, width_values, discretization_size, num_timesteps, 0.02, new BurgersFlux<Real>);
+    ASSERT_EQ(solver.peak_cells(), discretization_size);
+    for (auto t = 0; t < num_timesteps; t++) {
+        for (auto x = 0; x < discretization_size; x++) {
+            ASSERT_NEAR(adaptive.get(t, x).value(), scheme.get(t, x).value(), 1e-12);
+        }
+    }
+}
+
+/**
+ * By width, blocks are refined where enclosures are wide, and block averages still enclose the real solution.
+ */
+TEST(amr, refines_wide_enclosures) {
+    auto discretization_size = 12;
+    auto num_timesteps = 3;
+    auto width_values = std::vector<double>(discretization_size, 0.1);
+    auto interval_conditions = std::vector<Winterval>(discretization_size);
+    auto real_conditions = std::vector<Real>(discretization_size);
+    for (auto x = 0; x < discretization_size; x++) {
+        auto radius = x == 8 ? 0.2 : 0.001;
+        interval_conditions[x] = Winterval(0.5 - radius, 0.5 + radius);
+        real_conditions[x] = 0.5;
+    }
+
+    auto solver = adaptive_solver<Winterval>(RefinementCriterion::width, 0.1);
+    auto interval_solution = solver.solve(interval_conditions, width_values, discretization_size, num_timesteps, 0.02, new BurgersFlux<Winterval>);
+    ASSERT_EQ(solver.levels()[8], 2);
+    ASSERT_EQ(solver.levels()[2], 0);
+
+    auto real_solution = RiemannSolver<Real>().solve(real_conditions, width_values, discretization_size, num_timesteps, 0.02, new BurgersFlux<Real>);
+    for (auto t = 0; t < num_timesteps; t++) {
+        for (auto x = 0; x < discretization_size; x++) {
+            ASSERT_GE(real_solution.get(t, x).value(), interval_solution.get(t, x).min() - 1e-12);
+            ASSERT_LE(real_solution.get(t, x).value(), interval_solution.get(t, x).max() + 1e-12);
+        }
+    }
+}
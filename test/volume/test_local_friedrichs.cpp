@@ -32,9 +32,60 @@ TEST(llf, real_llf) {
     auto solution_matrix = solver.solve(initial_conditions, width_values, discretization_size, num_timesteps, delta_t, new BurgersFlux<Real>);
 
     ASSERT_TRUE(solver.cfl_check_mesh(solution_matrix, new BurgersFlux<Real>, delta_t, width_values));
-    ASSERT_NEAR(solution_matrix.get(3, 0).value(), 14.063770, 1e-5);
-    ASSERT_NEAR(solution_matrix.get(3, 1).value(), 10.148959, 1e-5);
-    ASSERT_NEAR(solution_matrix.get(3, 2).value(), 2.661306, 1e-5);
-    ASSERT_NEAR(solution_matrix.get(3, 3).value(), 3.411484, 1e-5);
-    ASSERT_NEAR(solution_matrix.get(3, 4).value(), 17.701213, 1e-5);
-}
\ No newline at end of file
+    ASSERT_NEAR(solution_matrix.get(3, 0).value(), 1.395609, 1e-5);
+    ASSERT_NEAR(solution_matrix.get(3, 1).value(), 2.574035, 1e-5);
+    ASSERT_NEAR(solution_matrix.get(3, 2).value(), 2.822906, 1e-5);
+    ASSERT_NEAR(solution_matrix.get(3, 3).value(), 2.740535, 1e-5);
+    ASSERT_NEAR(solution_matrix.get(3, 4).value(), 1.316914, 1e-5);
+}
+
+/**
+ * Finite volume schemes are conservative: with periodic boundaries, total mass sum(u * width) is constant,
+ * even when the cells have different widths.
+ */
+TEST(llf, nonuniform_conservation) {
+    auto discretization_size = 6;
+    auto num_timesteps = 20;
+
+    auto initial_conditions = std::vector<Real>{0.1, 0.4, 0.9, 0.7, 0.3, 0.2};
+    auto width_values = std::vector<double>{1, 0.5, 0.25, 0.25, 0.5, 1};
+    auto delta_t = 0.05;
+
+    auto solver = LocalLaxFriedrichsSolver<Real>();
+    auto solution_matrix = solver.solve(initial_conditions, width_values, discretization_size, num_timesteps, delta_t, new BurgersFlux<Real>);
+    ASSERT_TRUE(solver.cfl_check_mesh(solution_matrix, new BurgersFlux<Real>, delta_t, width_values));
+
+    auto mass = [&](uint32_t timestep) {
+        auto total = 0.0;
+        for (auto x = 0; x < discretization_size; x++) {
+            total += solution_matrix.get(timestep, x).value() * width_values[x];
+        }
+        return total;
+    };
+    ASSERT_NEAR(mass(num_timesteps - 1), mass(0), 1e-12);
+}
+/**
+ * CFL violations tracked while solving must match checking the finished mesh.
+ */
+TEST(llf, tracked_cfl) {
+    auto discretization_size = 5;
+    auto num_timesteps = 6;
+    auto initial_conditions = std::vector<Real>{1.39, 2.66, 2.84, 2.75, 1.21};
+    auto width_values = std::vector<double>{1, 1, 0.5, 1, 1};
+    auto solver = LocalLaxFriedrichsSolver<Real>();
+    solver.track_cfl(true);
+
+    // Passes everywhere.
+    auto solution_matrix = solver.solve(initial_conditions, width_values, discretization_size, num_timesteps, 0.01, new BurgersFlux<Real>);
+    ASSERT_TRUE(solver.tracked_cfl_check());
+    ASSERT_TRUE(solver.cfl_check_mesh(solution_matrix, new BurgersFlux<Real>, 0.01, width_values));
+
+    // Fails first in the narrow cell: 2.84 * 0.2 / 0.5 > 1.
+    auto violating_matrix = solver.solve(initial_conditions, width_values, discretization_size, num_timesteps, 0.2, new BurgersFlux<Real>);
+    ASSERT_FALSE(solver.tracked_cfl_check());
+    ASSERT_FALSE(solver.cfl_check_mesh(violating_matrix, new BurgersFlux<Real>, 0.2, width_values));
+
+    // Tracking resets between solves.
+    solver.solve(initial_conditions, width_values, discretization_size, num_timesteps, 0.01, new BurgersFlux<Real>);
+    ASSERT_TRUE(solver.tracked_cfl_check());
+}
@@ -0,0 +1,161 @@
+//
+// Created by will on 12/10/25.
+//
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <numbers>
+#include <numeric>
+
+#include "Winterval/Winterval.hpp"
+#include "domains/Real.hpp"
+#include "flux/BurgersFlux.hpp"
+#include "solvers/volume/LocalLaxFriedrichsSolver.hpp"
+#include "solvers/volume/LocalTimeSteppingSolver.hpp"
+#include "solvers/volume/RiemannSolver.hpp"
+
+#include "IntervalContainment.hpp"
+
+/*
+ * Grid refined around its center, from width 0.1 down to 0.1 / 16.
+ */
+static std::vector<double> refined_widths(uint32_t discretization_size) {
+    auto width_values = std::vector<double>(discretization_size);
+    for (uint32_t x = 0; x < discretization_size; x++) {
+        auto distance = std::abs(static_cast<int64_t>(x) - static_cast<int64_t>(discretization_size / 2));
+        width_values[x] = 0.1 / std::pow(2, std::max<int64_t>(0, 4 - distance));
+    }
+    return width_values;
+}
+
+TEST(local_time_stepping, time_levels) {
+    auto levels = TimeLevels({1, 0.5, 0.3, 1, 0.1});
+    ASSERT_EQ(levels.finest_level(), 4);
+    ASSERT_EQ(levels.substeps(), 16);
+
+    auto cell_levels = std::vector<uint32_t>{0, 1, 2, 0, 4};
+    for (auto x = 0; x < 5; x++) {
+        ASSERT_EQ(levels.cell_level(x), cell_levels[x]);
+        ASSERT_GE(levels.step_widths()[x], 1);
+        ASSERT_LT(levels.step_widths()[x], 2);
+    }
+    // Edges of the system step at the finest level, and others at their finer cell.
+    auto interface_levels = std::vector<uint32_t>{4, 1, 2, 2, 4, 4};
+    for (auto x = 0; x <= 5; x++) {
+        ASSERT_EQ(levels.interface_level(x), interface_levels[x]);
+    }
+
+    ASSERT_EQ(levels.coarsest_level_at(0), 0);
+    ASSERT_EQ(levels.coarsest_level_at(1), 4);
+    ASSERT_EQ(levels.coarsest_level_at(4), 2);
+    ASSERT_EQ(levels.coarsest_level_at(8), 1);
+    ASSERT_EQ(levels.coarsest_level_at(16), 0);
+}
+
+/**
+ * On a uniform grid, every cell takes the full step, so local time stepping changes nothing.
+ */
+TEST(local_time_stepping, uniform_matches_global) {
+    auto discretization_size = 12;
+    auto num_timesteps = 10;
+    auto initial_conditions = std::vector<Real>(discretization_size);
+    for (auto x = 0; x < discretization_size; x++) {
+        initial_conditions[x] = x < discretization_size / 2 ? 1.0 + 0.1 * x : -0.5;
+    }
+    auto width_values = std::vector<double>(discretization_size, 0.1);
+
+    auto global_solution = LocalLaxFriedrichsSolver<Real>().solve(initial_conditions, width_values, discretization_size, num_timesteps, 0.04, new BurgersFlux<Real>);
+    auto solver = LocalLaxFriedrichsSolver<Real>();
+    solver.set_local_time_stepping(true);
+    auto local_solution = solver.solve(initial_conditions, width_values, discretization_size, num_timesteps, 0.04, new BurgersFlux<Real>);
+    for (auto t = 0; t < num_timesteps; t++) {
+        for (auto x = 0; x < discretization_size; x++) {
+            ASSERT_NEAR(local_solution.get(t, x).value(), global_solution.get(t, x).value(), 1e-12);
+        }
+    }
+}
+
+/**
+ * With a step suited to the widest cells, global stepping violates the CFL condition in refined cells,
+ * while local time stepping satisfies it everywhere and conserves mass across level interfaces.
+ */
+TEST(local_time_stepping, refined_conservation) {
+    auto discretization_size = 32;
+    auto num_timesteps = 20;
+    auto width_values = refined_widths(discretization_size);
+    auto initial_conditions = std::vector<Real>(discretization_size);
+    for (auto x = 0; x < discretization_size; x++) {
+        initial_conditions[x] = x < discretization_size / 2 ? 1 : 0.25;
+    }
+    auto delta_t = 0.08;
+
+    auto global_solver = LocalLaxFriedrichsSolver<Real>();
+    global_solver.track_cfl(true);
+    global_solver.solve(initial_conditions, width_values, discretization_size, num_timesteps, delta_t, new BurgersFlux<Real>);
+    ASSERT_FALSE(global_solver.tracked_cfl_check());
+
+    auto mass = [&](const RectangularMesh<Real> &solution, uint32_t timestep) {
+        auto total = 0.0;
+        for (auto x = 0; x < discretization_size; x++) {
+            total += solution.get(timestep, x).value() * width_values[x];
+        }
+        return total;
+    };
+    auto check = [&](LocalTimeSteppingSolver<Real> &solver) {
+        solver.set_local_time_stepping(true);
+        solver.track_cfl(true);
+        auto solution = solver.solve(initial_conditions, width_values, discretization_size, num_timesteps, delta_t, new BurgersFlux<Real>);
+        ASSERT_TRUE(solver.tracked_cfl_check());
+        for (auto t = 0; t < num_timesteps; t++) {
+            ASSERT_NEAR(mass(solution, t), mass(solution, 0), 1e-12);
+            // Monotone, so no new extrema.
+            for (auto x = 0; x < discretization_size; x++) {
+                ASSERT_GE(solution.get(t, x).value(), 0.25 - 1e-12);
+                ASSERT_LE(solution.get(t, x).value(), 1 + 1e-12);
+            }
+        }
+    };
+    auto local_lax_friedrichs = LocalLaxFriedrichsSolver<Real>();
+    check(local_lax_friedrichs);
+    auto riemann = RiemannSolver<Real>();
+    check(riemann);
+}
+
+/**
+ * Local time stepping approximates the same solution as stepping every cell at the finest step.
+ */
+TEST(local_time_stepping, matches_finest_step) {
+    auto discretization_size = 32;
+    auto num_timesteps = 11;
+    auto width_values = refined_widths(discretization_size);
+    auto length = std::accumulate(width_values.begin(), width_values.end(), 0.0);
+    auto initial_conditions = std::vector<Real>(discretization_size);
+    auto position = 0.0;
+    for (auto x = 0; x < discretization_size; x++) {
+        initial_conditions[x] = 0.5 + 0.25 * std::sin(2 * std::numbers::pi * (position + width_values[x] / 2) / length);
+        position += width_values[x];
+    }
+    auto delta_t = 0.08;
+    auto substeps = TimeLevels(width_values).substeps();
+
+    auto solver = RiemannSolver<Real>();
+    solver.set_local_time_stepping(true);
+    auto local_solution = solver.solve(initial_conditions, width_values, discretization_size, num_timesteps, delta_t, new BurgersFlux<Real>);
+    auto fine_solution = RiemannSolver<Real>().solve(initial_conditions, width_values, discretization_size,
+        (num_timesteps - 1) * substeps + 1, delta_t / substeps, new BurgersFlux<Real>);
+    for (auto x = 0; x < discretization_size; x++) {
+        ASSERT_NEAR(local_solution.get(num_timesteps - 1, x).value(), fine_solution.get((num_timesteps - 1) * substeps, x).value(), 0.02);
+    }
+}
+
+/**
+ * Solving over intervals encloses the real solutions from within the initial intervals.
+ */
+TEST(local_time_stepping, interval_contains_real) {
+    auto make_solver = [](auto domain) {
+        auto solver = LocalLaxFriedrichsSolver<decltype(domain)>();
+        solver.set_local_time_stepping(true);
+        return solver;
+    };
+    expect_interval_contains_real(make_solver, {1, 0.5, 0.25, 0.25, 0.5, 1}, 4, 0.05, 0.001);
+}
@@ -0,0 +1,136 @@
+//
+// Created by will on 12/10/25.
+//
+
+#include <gtest/gtest.h>
+#include <cmath>
+
+#include "Winterval/Winterval.hpp"
+#include "domains/Real.hpp"
+#include "flux/BurgersFlux.hpp"
+#include "solvers/volume/LocalLaxFriedrichsSolver.hpp"
+#include "solvers/volume/MusclSolver.hpp"
+
+#include "IntervalContainment.hpp"
+#include "SmoothBurgers.hpp"
+
+/*
+ * L1 error of a solver at its last timestep against the exact solution, over a uniform periodic grid.
+ * Limiters clip smooth extrema, so the largest error converges more slowly than the L1 error.
+ */
+template<typename S>
+static double smooth_error(S &solver, uint32_t discretization_size, uint32_t num_timesteps, double delta_t) {
+    auto width = 1.0 / discretization_size;
+    auto initial_conditions = std::vector<Real>(discretization_size);
+    for (uint32_t x = 0; x < discretization_size; x++) {
+        initial_conditions[x] = smooth_initial((x + 0.5) * width);
+    }
+    auto width_values = std::vector<double>(discretization_size, width);
+    auto solution = solver.solve(initial_conditions, width_values, discretization_size, num_timesteps, delta_t, new BurgersFlux<Real>);
+
+    auto time = (num_timesteps - 1) * delta_t;
+    auto error = 0.0;
+    for (uint32_t x = 0; x < discretization_size; x++) {
+        error += std::abs(solution.get(num_timesteps - 1, x).value() - smooth_exact((x + 0.5) * width, time)) * width;
+    }
+    return error;
+}
+
+TEST(muscl, limiters) {
+    ASSERT_DOUBLE_EQ(MusclSolver<Real>::minmod(1, 2).value(), 1);
+    ASSERT_DOUBLE_EQ(MusclSolver<Real>::minmod(-3, -2).value(), -2);
+    ASSERT_DOUBLE_EQ(MusclSolver<Real>::minmod(-1, 2).value(), 0);
+    ASSERT_DOUBLE_EQ(MusclSolver<Real>::van_leer(1, 3).value(), 1.5);
+    ASSERT_DOUBLE_EQ(MusclSolver<Real>::van_leer(1, -3).value(), 0);
+    ASSERT_DOUBLE_EQ(MusclSolver<Real>::van_leer(0, 0).value(), 0);
+
+    // Enclosures of slopes enclose the limited slope of every member.
+    auto limited = MusclSolver<Winterval>::minmod(Winterval(-1, 2), Winterval(1, 3));
+    ASSERT_LE(limited.min(), -1);
+    ASSERT_GE(limited.max(), 2);
+}
+
+/**
+ * Interfaces are shared between neighboring cells, so mass is conserved even on nonuniform grids.
+ */
+TEST(muscl, nonuniform_conservation) {
+    auto discretization_size = 6;
+    auto num_timesteps = 20;
+
+    auto initial_conditions = std::vector<Real>{0.1, 0.4, 0.9, 0.7, 0.3, 0.2};
+    auto width_values = std::vector<double>{1, 0.5, 0.25, 0.25, 0.5, 1};
+    auto delta_t = 0.05;
+
+    for (auto rk_order : {2, 3}) {
+        for (auto limiter : {SlopeLimiter::minmod, SlopeLimiter::van_leer}) {
+            auto solver = MusclSolver<Real>();
+            solver.set_rk_order(rk_order);
+            solver.set_limiter(limiter);
+            solver.track_cfl(true);
+            auto solution_matrix = solver.solve(initial_conditions, width_values, discretization_size, num_timesteps, delta_t, new BurgersFlux<Real>);
+            ASSERT_TRUE(solver.tracked_cfl_check());
+
+            auto mass = [&](uint32_t timestep) {
+                auto total = 0.0;
+                for (auto x = 0; x < discretization_size; x++) {
+                    total += solution_matrix.get(timestep, x).value() * width_values[x];
+                }
+                return total;
+            };
+            ASSERT_NEAR(mass(num_timesteps - 1), mass(0), 1e-12);
+        }
+    }
+}
+
+/**
+ * On a smooth solution, the second order scheme with half the cells is more accurate than local Lax-Friedrichs.
+ */
+TEST(muscl, smooth_accuracy) {
+    auto delta_t = 0.004;
+    auto num_timesteps = 76;
+
+    auto llf = LocalLaxFriedrichsSolver<Real>();
+    auto llf_error = smooth_error(llf, 64, num_timesteps, delta_t);
+    for (auto rk_order : {2, 3}) {
+        auto muscl = MusclSolver<Real>();
+        muscl.set_rk_order(rk_order);
+        auto coarse_error = smooth_error(muscl, 32, num_timesteps, delta_t);
+        auto fine_error = smooth_error(muscl, 64, num_timesteps, delta_t);
+
+        ASSERT_LT(coarse_error, llf_error);
+        // Second order: halving the width should roughly quarter the error.
+        ASSERT_LT(fine_error, coarse_error / 3);
+    }
+}
+
+/**
+ * Limited slopes create no new extrema, even at a discontinuity.
+ */
+TEST(muscl, no_new_extrema) {
+    auto discretization_size = 20;
+    auto num_timesteps = 30;
+    auto initial_conditions = std::vector<Real>(discretization_size);
+    for (auto x = 0; x < discretization_size; x++) {
+        initial_conditions[x] = x < discretization_size / 2 ? 1 : 0.25;
+    }
+    auto width_values = std::vector<double>(discretization_size, 0.1);
+
+    for (auto limiter : {SlopeLimiter::minmod, SlopeLimiter::van_leer}) {
+        auto solver = MusclSolver<Real>();
+        solver.set_limiter(limiter);
+        auto solution_matrix = solver.solve(initial_conditions, width_values, discretization_size, num_timesteps, 0.04, new BurgersFlux<Real>);
+        for (auto t = 0; t < num_timesteps; t++) {
+            for (auto x = 0; x < discretization_size; x++) {
+                ASSERT_GE(solution_matrix.get(t, x).value(), 0.25 - 1e-12);
+                ASSERT_LE(solution_matrix.get(t, x).value(), 1 + 1e-12);
+            }
+        }
+    }
+}
+
+/**
+ * Solving over intervals encloses the real solutions from within the initial intervals.
+ */
+TEST(muscl, interval_contains_real) {
+    expect_interval_contains_real([](auto domain) { return MusclSolver<decltype(domain)>(); }, {1, 1, 0.5, 1, 1}, 6, 0.01, 0.01);
+}
@@ -0,0 +1,135 @@
+//
+// Created by will on 12/10/25.
+//
+
+#include <gtest/gtest.h>
+
+#include "Winterval/Winterval.hpp"
+#include "domains/Real.hpp"
+#include "domains/RealBatch.hpp"
+#include "flux/BuckleyLeverettFlux.hpp"
+#include "flux/BurgersFlux.hpp"
+#include "flux/CubicFlux.hpp"
+#include "solvers/volume/LocalLaxFriedrichsSolver.hpp"
+#include "solvers/volume/RiemannSolver.hpp"
+
+TEST(riemann, godunov_real) {
+    auto burgers = BurgersFlux<Real>();
+    auto burgers_points = burgers.stationary_points();
+    auto godunov = [&](double left, double right) {
+        return RiemannSolver<Real, BurgersFlux<Real>>::godunov_flux(left, right, &burgers, burgers_points).value();
+    };
+    // Shocks take the greater flux, rarefactions the lesser, and transonic rarefactions the sonic point.
+    ASSERT_DOUBLE_EQ(godunov(1, -1), 0.5);
+    ASSERT_DOUBLE_EQ(godunov(2, 1), 2);
+    ASSERT_DOUBLE_EQ(godunov(-1, 1), 0);
+    ASSERT_DOUBLE_EQ(godunov(-2, -1), 0.5);
+
+    // Buckley-Leverett is non-convex, with stationary points at both ends of the unit interval.
+    auto buckley_leverett = BuckleyLeverett<Real>();
+    auto buckley_leverett_points = buckley_leverett.stationary_points();
+    auto buckley_leverett_godunov = [&](double left, double right) {
+        return RiemannSolver<Real, BuckleyLeverett<Real>>::godunov_flux(left, right, &buckley_leverett, buckley_leverett_points).value();
+    };
+    ASSERT_DOUBLE_EQ(buckley_leverett_godunov(0, 1), 0);
+    ASSERT_DOUBLE_EQ(buckley_leverett_godunov(1, 0), 1);
+    ASSERT_DOUBLE_EQ(buckley_leverett_godunov(0.2, 0.8), buckley_leverett.flux(0.2).value());
+}
+
+/**
+ * The Godunov flux between enclosures encloses the flux between every pair of enclosed states.
+ */
+TEST(riemann, godunov_interval) {
+    auto real_flux = CubicFlux<Real>();
+    auto interval_flux = CubicFlux<Winterval>();
+    auto left = Winterval(-0.5, 0.25);
+    auto right = Winterval(-0.25, 1);
+    auto enclosure = RiemannSolver<Winterval, CubicFlux<Winterval>>::godunov_flux(left, right, &interval_flux, interval_flux.stationary_points());
+
+    for (auto i = 0; i <= 10; i++) {
+        for (auto j = 0; j <= 10; j++) {
+            auto u_left = left.min() + (left.max() - left.min()) * i / 10;
+            auto u_right = right.min() + (right.max() - right.min()) * j / 10;
+            auto value = RiemannSolver<Real, CubicFlux<Real>>::godunov_flux(u_left, u_right, &real_flux, real_flux.stationary_points()).value();
+            ASSERT_GE(value, enclosure.min() - 1e-12);
+            ASSERT_LE(value, enclosure.max() + 1e-12);
+        }
+    }
+}
+
+/**
+ * HLL upwinds where both states move the same way, and otherwise lies between the fluxes of the two states.
+ */
+TEST(riemann, hll_real) {
+    auto flux = BurgersFlux<Real>();
+    auto hll = [&](double left, double right) {
+        return RiemannSolver<Real, BurgersFlux<Real>>::hll_flux(left, right, flux.flux_with_derivative(left), flux.flux_with_derivative(right)).value();
+    };
+    ASSERT_DOUBLE_EQ(hll(2, 1), 2);
+    ASSERT_DOUBLE_EQ(hll(-1, -2), 2);
+    ASSERT_DOUBLE_EQ(hll(0, 0), 0);
+    // Symmetric rarefaction: (1 * 0.5 - (-1) * 0.5 + (-1) * 1 * 2) / 2.
+    ASSERT_DOUBLE_EQ(hll(-1, 1), -0.5);
+}
+
+/**
+ * Batches are solved lane by lane, matching each lane solved over reals.
+ */
+TEST(riemann, godunov_batch) {
+    auto batch_flux = BuckleyLeverett<RealBatch<2>>();
+    auto real_flux = BuckleyLeverett<Real>();
+    auto left = RealBatch<2>(0.9);
+    left.set(1, 0.1);
+    auto right = RealBatch<2>(0.1);
+    right.set(1, 0.9);
+
+    auto result = RiemannSolver<RealBatch<2>, BuckleyLeverett<RealBatch<2>>>::godunov_flux(left, right, &batch_flux, batch_flux.stationary_points());
+    for (auto lane = 0; lane < 2; lane++) {
+        auto expected = RiemannSolver<Real, BuckleyLeverett<Real>>::godunov_flux(
+            left.value(lane), right.value(lane), &real_flux, real_flux.stationary_points());
+        ASSERT_DOUBLE_EQ(result.value(lane), expected.value());
+    }
+}
+
+/**
+ * Both fluxes are conservative on nonuniform grids, and smear a shock over fewer cells than local Lax-Friedrichs.
+ */
+TEST(riemann, sharper_shocks) {
+    auto discretization_size = 40;
+    auto num_timesteps = 40;
+    auto initial_conditions = std::vector<Real>(discretization_size);
+    for (auto x = 0; x < discretization_size; x++) {
+        initial_conditions[x] = x >= 5 && x < 15 ? 1 : 0;
+    }
+    auto width_values = std::vector<double>(discretization_size, 0.1);
+    width_values[20] = 0.05;
+    auto delta_t = 0.04;
+
+    // Cells partway between the states either side of the shock.
+    auto smeared = [&](const RectangularMesh<Real> &solution) {
+        auto count = 0;
+        for (auto x = 0; x < discretization_size; x++) {
+            auto value = solution.get(num_timesteps - 1, x).value();
+            count += value > 0.05 && value < 0.5;
+        }
+        return count;
+    };
+    auto mass = [&](const RectangularMesh<Real> &solution, uint32_t timestep) {
+        auto total = 0.0;
+        for (auto x = 0; x < discretization_size; x++) {
+            total += solution.get(timestep, x).value() * width_values[x];
+        }
+        return total;
+    };
+
+    auto llf_solution = LocalLaxFriedrichsSolver<Real>().solve(initial_conditions, width_values, discretization_size, num_timesteps, delta_t, new BurgersFlux<Real>);
+    for (auto riemann_flux : {RiemannFlux::godunov, RiemannFlux::hll}) {
+        auto solver = RiemannSolver<Real>();
+        solver.set_riemann_flux(riemann_flux);
+        solver.track_cfl(true);
+        auto solution = solver.solve(initial_conditions, width_values, discretization_size, num_timesteps, delta_t, new BurgersFlux<Real>);
+        ASSERT_TRUE(solver.tracked_cfl_check());
+        ASSERT_NEAR(mass(solution, num_timesteps - 1), mass(solution, 0), 1e-12);
+        ASSERT_LT(smeared(solution), smeared(llf_solution));
+    }
+}
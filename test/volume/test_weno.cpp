@@ -0,0 +1,159 @@
+//
+// Created by will on 12/10/25.
+//
+
+#include <gtest/gtest.h>
+#include <cmath>
+
+#include "Winterval/Winterval.hpp"
+#include "domains/Real.hpp"
+#include "domains/RealBatch.hpp"
+#include "flux/BurgersFlux.hpp"
+#include "solvers/volume/MusclSolver.hpp"
+#include "solvers/volume/WenoSolver.hpp"
+
+#include "IntervalContainment.hpp"
+#include "SmoothBurgers.hpp"
+
+/*
+ * Exact cell average of Burgers' equation from smooth_initial before shocks form.
+ * Point values along characteristics are averaged by Gauss-Legendre quadrature,
+ * since a fifth order scheme resolves the difference between averages and midpoint values.
+ */
+static double smooth_average(double left, double width, double t) {
+    auto nodes = std::array<double, 3>{-std::sqrt(0.6), 0, std::sqrt(0.6)};
+    auto weights = std::array<double, 3>{5.0 / 9, 8.0 / 9, 5.0 / 9};
+    auto total = 0.0;
+    for (auto i = 0; i < 3; i++) {
+        total += weights[i] * smooth_exact(left + width * (1 + nodes[i]) / 2, t);
+    }
+    return total / 2;
+}
+
+/*
+ * L1 error of a solver at its last timestep against the exact cell averages, over a uniform periodic grid.
+ */
+template<typename S>
+static double smooth_error(S &&solver, uint32_t discretization_size, uint32_t num_timesteps, double delta_t) {
+    auto width = 1.0 / discretization_size;
+    auto initial_conditions = std::vector<Real>(discretization_size);
+    for (uint32_t x = 0; x < discretization_size; x++) {
+        initial_conditions[x] = smooth_average(x * width, width, 0);
+    }
+    auto width_values = std::vector<double>(discretization_size, width);
+    auto solution = solver.solve(initial_conditions, width_values, discretization_size, num_timesteps, delta_t, new BurgersFlux<Real>);
+
+    auto time = (num_timesteps - 1) * delta_t;
+    auto error = 0.0;
+    for (uint32_t x = 0; x < discretization_size; x++) {
+        error += std::abs(solution.get(num_timesteps - 1, x).value() - smooth_average(x * width, width, time)) * width;
+    }
+    return error;
+}
+
+/**
+ * WENO5 reproduces polynomials up to degree four exactly on smooth data, i.e. the edge value of a line.
+ */
+TEST(weno, linear_reconstruction) {
+    ASSERT_NEAR(WenoSolver<Real>::weno5(1.0, 2.0, 3.0, 4.0, 5.0), 3.5, 1e-12);
+    ASSERT_NEAR(WenoSolver<Real>::weno5(Real(1), Real(2), Real(3), Real(4), Real(5)).value(), 3.5, 1e-12);
+
+    // Next to a discontinuity, the smooth sub-stencil dominates.
+    ASSERT_NEAR(WenoSolver<Real>::weno5(1.0, 1.0, 1.0, 0.0, 0.0), 1, 1e-3);
+}
+
+/**
+ * Interfaces are shared between neighboring cells, so mass is conserved even on nonuniform grids.
+ */
+TEST(weno, nonuniform_conservation) {
+    auto discretization_size = 8;
+    auto num_timesteps = 20;
+
+    auto initial_conditions = std::vector<Real>{0.1, 0.4, 0.9, 0.7, 0.3, 0.2, 0.5, 0.6};
+    auto width_values = std::vector<double>{1, 0.5, 0.25, 0.25, 0.5, 1, 1, 1};
+    auto delta_t = 0.05;
+
+    auto solver = WenoSolver<Real>();
+    solver.track_cfl(true);
+    auto solution_matrix = solver.solve(initial_conditions, width_values, discretization_size, num_timesteps, delta_t, new BurgersFlux<Real>);
+    ASSERT_TRUE(solver.tracked_cfl_check());
+
+    auto mass = [&](uint32_t timestep) {
+        auto total = 0.0;
+        for (auto x = 0; x < discretization_size; x++) {
+            total += solution_matrix.get(timestep, x).value() * width_values[x];
+        }
+        return total;
+    };
+    ASSERT_NEAR(mass(num_timesteps - 1), mass(0), 1e-12);
+}
+
+/**
+ * On a smooth solution, WENO5 with a quarter of the cells is more accurate than MUSCL, and converges at high order.
+ */
+TEST(weno, smooth_accuracy) {
+    auto delta_t = 0.002;
+    auto num_timesteps = 151;
+
+    auto muscl_error = smooth_error(MusclSolver<Real>(), 128, num_timesteps, delta_t);
+    auto coarse_error = smooth_error(WenoSolver<Real>(), 32, num_timesteps, delta_t);
+    auto fine_error = smooth_error(WenoSolver<Real>(), 64, num_timesteps, delta_t);
+
+    ASSERT_LT(coarse_error, muscl_error);
+    // Halving the width should divide the error by far more than a second order scheme's four.
+    ASSERT_LT(fine_error, coarse_error / 8);
+}
+
+/**
+ * Reconstruction of reals over doubles matches the generic reconstruction, i.e. as used by batches.
+ */
+TEST(weno, real_kernel_matches_generic) {
+    auto discretization_size = 12;
+    auto num_timesteps = 10;
+    auto width_values = std::vector<double>(discretization_size, 0.1);
+    auto delta_t = 0.02;
+
+    auto real_conditions = std::vector<Real>(discretization_size);
+    auto batch_conditions = std::vector<RealBatch<2>>(discretization_size);
+    for (auto x = 0; x < discretization_size; x++) {
+        auto value = x < discretization_size / 2 ? 1.0 + 0.1 * x : 0.2;
+        real_conditions[x] = value;
+        batch_conditions[x] = RealBatch<2>(value);
+    }
+
+    auto real_solution = WenoSolver<Real>().solve(real_conditions, width_values, discretization_size, num_timesteps, delta_t, new BurgersFlux<Real>);
+    auto batch_solution = WenoSolver<RealBatch<2>>().solve(batch_conditions, width_values, discretization_size, num_timesteps, delta_t, new BurgersFlux<RealBatch<2>>);
+    for (auto t = 0; t < num_timesteps; t++) {
+        for (auto x = 0; x < discretization_size; x++) {
+            ASSERT_NEAR(real_solution.get(t, x).value(), batch_solution.get(t, x).value(1), 1e-12);
+        }
+    }
+}
+
+/**
+ * Across a discontinuity, WENO5 is essentially non-oscillatory: overshoots stay small.
+ */
+TEST(weno, shock_overshoot) {
+    auto discretization_size = 40;
+    auto num_timesteps = 60;
+    auto initial_conditions = std::vector<Real>(discretization_size);
+    for (auto x = 0; x < discretization_size; x++) {
+        initial_conditions[x] = x < discretization_size / 2 ? 1 : 0.25;
+    }
+    auto width_values = std::vector<double>(discretization_size, 0.05);
+
+    auto solution_matrix = WenoSolver<Real>().solve(initial_conditions, width_values, discretization_size, num_timesteps, 0.02, new BurgersFlux<Real>);
+    for (auto t = 0; t < num_timesteps; t++) {
+        for (auto x = 0; x < discretization_size; x++) {
+            ASSERT_GE(solution_matrix.get(t, x).value(), 0.25 - 0.01);
+            ASSERT_LE(solution_matrix.get(t, x).value(), 1 + 0.01);
+        }
+    }
+}
+
+/**
+ * Solving over intervals encloses the real solutions from within the initial intervals.
+ */
+TEST(weno, interval_contains_real) {
+    expect_interval_contains_real([](auto domain) { return WenoSolver<decltype(domain)>(); }, std::vector<double>(6, 1), 4, 0.01, 0.001);
+}